@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <coroutine>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/modbus_tcp_session.hpp"
+#include "caparoc/read_planner.hpp"
+#include "caparoc/task.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Awaitable Transactions
+// ============================================================================
+
+/**
+ * @brief Awaitable read of consecutive holding registers
+ * 
+ * Resumes with the values, or std::nullopt on failure; error() tells why.
+ */
+class ReadRegisters {
+public:
+    ReadRegisters(ModbusTcpSession& session, uint16_t address, uint16_t count)
+        : session_(session), address_(address), count_(count) {
+    }
+    
+    bool await_ready() const noexcept { return false; }
+    
+    void await_suspend(std::coroutine_handle<> awaiting) {
+        session_.read_registers(address_, count_, [this, awaiting](std::error_code error, std::span<const uint16_t> values) {
+            error_ = error;
+            if (!error) {
+                values_.emplace(values.begin(), values.end());
+            }
+            awaiting.resume();
+        });
+    }
+    
+    std::optional<std::vector<uint16_t>> await_resume() { return std::move(values_); }
+    
+    std::error_code error() const { return error_; }
+
+private:
+    ModbusTcpSession& session_;
+    uint16_t address_;
+    uint16_t count_;
+    std::error_code error_;
+    std::optional<std::vector<uint16_t>> values_;
+};
+
+/**
+ * @brief Awaitable write of one or more consecutive registers
+ * 
+ * Resumes with true on success.
+ */
+class WriteRegisters {
+public:
+    WriteRegisters(ModbusTcpSession& session, uint16_t address, std::span<const uint16_t> values)
+        : session_(session), address_(address), values_(values.begin(), values.end()) {
+    }
+    
+    bool await_ready() const noexcept { return false; }
+    
+    void await_suspend(std::coroutine_handle<> awaiting) {
+        auto done = [this, awaiting](std::error_code error) {
+            error_ = error;
+            awaiting.resume();
+        };
+        if (values_.size() == 1) {
+            session_.write_register(address_, values_[0], std::move(done));
+        } else {
+            session_.write_registers(address_, values_, std::move(done));
+        }
+    }
+    
+    bool await_resume() const noexcept { return !error_; }
+    
+    std::error_code error() const { return error_; }
+
+private:
+    ModbusTcpSession& session_;
+    uint16_t address_;
+    std::vector<uint16_t> values_;
+    std::error_code error_;
+};
+
+/**
+ * @brief Awaitable connect
+ * 
+ * Resumes with true if the session is connected.
+ */
+class Connect {
+public:
+    explicit Connect(ModbusTcpSession& session)
+        : session_(session) {
+    }
+    
+    bool await_ready() const noexcept { return session_.connected(); }
+    
+    void await_suspend(std::coroutine_handle<> awaiting) {
+        session_.connect([this, awaiting](std::error_code error) {
+            error_ = error;
+            awaiting.resume();
+        });
+    }
+    
+    bool await_resume() const noexcept { return !error_ && session_.connected(); }
+    
+    std::error_code error() const { return error_; }
+
+private:
+    ModbusTcpSession& session_;
+    std::error_code error_;
+};
+
+/**
+ * @brief Awaitable execution of all requests of a read plan
+ * 
+ * All requests are handed to the session at once, so a pipelining session
+ * (SessionOptions::max_outstanding > 1) overlaps their round trips. Resumes with the
+ * values once every request has completed, or std::nullopt if any of them failed.
+ */
+class ReadPlanRequests {
+public:
+    ReadPlanRequests(ModbusTcpSession& session, ReadPlan plan)
+        : session_(session), plan_(std::move(plan)) {
+    }
+    
+    bool await_ready() const noexcept { return plan_.requests.empty(); }
+    
+    bool await_suspend(std::coroutine_handle<> awaiting);
+    
+    std::optional<RegisterValues> await_resume();
+    
+    /// First error reported by any request
+    std::error_code error() const { return error_; }
+
+private:
+    ModbusTcpSession& session_;
+    ReadPlan plan_;
+    size_t remaining_ = 0;
+    std::error_code error_;
+    RegisterValues values_;
+};
+
+// ============================================================================
+// Asynchronous Device Functions
+// ============================================================================
+
+/**
+ * @brief Connect a session
+ */
+inline Connect connect(ModbusTcpSession& session) {
+    return Connect(session);
+}
+
+/**
+ * @brief Read consecutive holding registers
+ */
+inline ReadRegisters read_registers(ModbusTcpSession& session, uint16_t address, uint16_t count) {
+    return ReadRegisters(session, address, count);
+}
+
+/**
+ * @brief Write one register (FC 0x06) or consecutive registers (FC 0x10)
+ */
+inline WriteRegisters write_registers(ModbusTcpSession& session, uint16_t address, std::span<const uint16_t> values) {
+    return WriteRegisters(session, address, values);
+}
+
+/**
+ * @brief Read a single register
+ */
+Task<std::optional<uint16_t>> read_uint16(ModbusTcpSession& session, uint16_t address);
+
+/**
+ * @brief Write a single register
+ */
+Task<bool> write_uint16(ModbusTcpSession& session, uint16_t address, uint16_t value);
+
+/**
+ * @brief Get global status byte (0x6000)
+ */
+Task<std::optional<GlobalStatus>> get_global_status(ModbusTcpSession& session);
+
+/**
+ * @brief Execute all requests of a read plan concurrently
+ * 
+ * @param session MODBUS/TCP session
+ * @param plan Plan to execute (copied)
+ * @return Task<std::optional<RegisterValues>> Values if all requests succeeded
+ */
+Task<std::optional<RegisterValues>> execute_read_plan(ModbusTcpSession& session, ReadPlan plan);
+
+/**
+ * @brief Read the complete status block (0x6000-0x60CF)
+ * 
+ * Asynchronous counterpart of caparoc::read_status_snapshot() using the same plan.
+ * The block reads are issued concurrently (see ReadPlanRequests).
+ * 
+ * @param session MODBUS/TCP session
+ * @return Task<std::optional<StatusSnapshot>> Decoded snapshot if all reads succeeded
+ */
+Task<std::optional<StatusSnapshot>> read_status_snapshot(ModbusTcpSession& session);
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -3,13 +3,79 @@
 #include <string>
 #include <optional>
 #include <cstdint>
+#include <cstddef>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <stop_token>
+#include <string_view>
 #include <vector>
+#include "caparoc/handler_list.hpp"
 #include "caparoc/registers.hpp"
 #include "libmodbus_cpp/modbus_connection.hpp"
 
 namespace caparoc {
 inline namespace v1 {
 
+// ============================================================================
+// Device Limits
+// ============================================================================
+
+/// Maximum number of registers in one MODBUS read request (function code 0x03)
+constexpr uint16_t max_read_registers = 125;
+
+/// Maximum number of registers in one MODBUS write request (function code 0x10)
+constexpr uint16_t max_write_registers = 123;
+
+/// Maximum number of circuit breaker modules behind one power module
+constexpr uint8_t max_modules = 16;
+
+/// Number of channel slots reserved per module in the register map
+constexpr uint8_t channels_per_module = 4;
+
+/// Total number of channel slots in the register map
+constexpr size_t max_channels = max_modules * channels_per_module;
+
+/**
+ * @brief Index of a channel slot in per-channel register blocks
+ * 
+ * @param module_number Module number (1-16)
+ * @param channel_number Channel number (1-4)
+ * @return size_t Zero-based index: (module_number - 1) * 4 + (channel_number - 1)
+ */
+constexpr size_t channel_index(uint8_t module_number, uint8_t channel_number) {
+    return static_cast<size_t>(module_number - 1) * channels_per_module + (channel_number - 1);
+}
+
+// ============================================================================
+// Deadlines
+// ============================================================================
+
+/**
+ * @brief Point in time by which a multi-transaction operation must finish
+ *
+ * A transaction that is already on the wire cannot be aborted, so deadlines are
+ * checked between transactions: an operation may overrun its deadline by at most
+ * one response timeout.
+ */
+using Deadline = std::chrono::steady_clock::time_point;
+
+/**
+ * @brief Check whether no further transaction may be started
+ *
+ * @param deadline Budget of the operation
+ * @param stop Stop token of the caller
+ * @return true if the deadline has passed or a stop was requested
+ */
+inline bool budget_exhausted(Deadline deadline, const std::stop_token& stop) {
+    return stop.stop_requested() || std::chrono::steady_clock::now() >= deadline;
+}
+
 // ============================================================================
 // Generic Register Access Functions
 // ============================================================================
@@ -41,6 +107,25 @@ std::optional<uint32_t> read_uint32(libmodbus_cpp::ModbusConnection& conn, uint1
  */
 std::optional<std::string> read_string32(libmodbus_cpp::ModbusConnection& conn, uint16_t address);
 
+/**
+ * @brief Decode a string from register values (2 characters per register, high byte first)
+ * 
+ * @param values Register values, e.g. the 16 registers of a String32
+ * @return std::string Decoded string, truncated at the first null byte
+ */
+std::string decode_string(std::span<const uint16_t> values);
+
+/**
+ * @brief Read a block of consecutive registers in a single transaction
+ * 
+ * @param conn MODBUS connection
+ * @param address Starting register address
+ * @param values Destination, its size is the number of registers to read (1-125)
+ * @return true if successful
+ * @return false if failed or values.size() exceeds max_read_registers
+ */
+bool read_registers(libmodbus_cpp::ModbusConnection& conn, uint16_t address, std::span<uint16_t> values);
+
 /**
  * @brief Write a UINT16 register
  * 
@@ -63,6 +148,102 @@ bool write_uint16(libmodbus_cpp::ModbusConnection& conn, uint16_t address, uint1
  */
 bool write_uint32(libmodbus_cpp::ModbusConnection& conn, uint16_t address, uint32_t value);
 
+/**
+ * @brief Write a block of consecutive registers in a single transaction
+ * 
+ * A single value is written with function code 0x06, longer blocks with 0x10.
+ * 
+ * @param conn MODBUS connection
+ * @param address Starting register address
+ * @param values Values to write (1-123 registers)
+ * @return true if successful
+ * @return false if failed or values.size() exceeds max_write_registers
+ */
+bool write_registers(libmodbus_cpp::ModbusConnection& conn, uint16_t address, std::span<const uint16_t> values);
+
+// ============================================================================
+// Typed Register Access
+// ============================================================================
+
+/**
+ * @brief Register<> descriptor that may be read (not write-only)
+ */
+template <typename Reg>
+concept ReadableRegister = Reg::access != RegisterAccess::WRITE_ONLY;
+
+/**
+ * @brief Register<> descriptor that may be written (not read-only, not a string)
+ */
+template <typename Reg>
+concept WritableRegister = Reg::access != RegisterAccess::READ_ONLY && !std::same_as<typename Reg::value_type, std::string>;
+
+/**
+ * @brief Decode the raw words of a typed register (high word first)
+ * 
+ * @param words Register values
+ * @return Reg::value_type Decoded value
+ */
+template <typename Reg>
+typename Reg::value_type decode(std::span<const uint16_t, Reg::num_registers> words) {
+    using T = typename Reg::value_type;
+    if constexpr (std::same_as<T, std::string>) {
+        return decode_string(words);
+    } else if constexpr (Reg::num_registers == 1) {
+        return static_cast<T>(words[0]);
+    } else {
+        return std::bit_cast<T>((static_cast<uint32_t>(words[0]) << 16) | words[1]);
+    }
+}
+
+/**
+ * @brief Encode a value of a typed register into raw words (high word first)
+ * 
+ * @param value Value to encode
+ * @return std::array<uint16_t, Reg::num_registers> Register values
+ */
+template <WritableRegister Reg>
+std::array<uint16_t, Reg::num_registers> encode(typename Reg::value_type value) {
+    if constexpr (Reg::num_registers == 1) {
+        return {static_cast<uint16_t>(value)};
+    } else {
+        const auto dword = std::bit_cast<uint32_t>(value);
+        return {static_cast<uint16_t>(dword >> 16), static_cast<uint16_t>(dword & 0xFFFF)};
+    }
+}
+
+/**
+ * @brief Read a register described by a Register<> type, e.g. read<regs::INTERNAL_TEMPERATURE>(conn)
+ * 
+ * Word count and decoding are fixed at compile time. Write-only registers do not compile.
+ * 
+ * @param conn MODBUS connection
+ * @return std::optional<typename Reg::value_type> Value if successful
+ */
+template <ReadableRegister Reg>
+std::optional<typename Reg::value_type> read(libmodbus_cpp::ModbusConnection& conn) {
+    std::array<uint16_t, Reg::num_registers> words{};
+    if (!read_registers(conn, Reg::address, words)) {
+        return std::nullopt;
+    }
+    return decode<Reg>(std::span<const uint16_t, Reg::num_registers>(words));
+}
+
+/**
+ * @brief Write a register described by a Register<> type, e.g. write<regs::LOCAL_USER_INTERFACE_LOCK>(conn, 1)
+ * 
+ * Read-only registers do not compile.
+ * 
+ * @param conn MODBUS connection
+ * @param value Value to write
+ * @return true if successful
+ * @return false if failed
+ */
+template <WritableRegister Reg>
+bool write(libmodbus_cpp::ModbusConnection& conn, typename Reg::value_type value) {
+    const auto words = encode<Reg>(value);
+    return write_registers(conn, Reg::address, words);
+}
+
 // ============================================================================
 // Control/Reset Functions (Backward Compatibility)
 // ============================================================================
@@ -164,6 +345,78 @@ std::string list_all_registers(const std::string& filter = "");
  */
 std::vector<RegisterInfo> find_registers(const std::string& pattern);
 
+/**
+ * @brief Fields compared by search_registers()
+ */
+enum class RegisterSearchScope {
+    name,
+    name_and_description
+};
+
+/**
+ * @brief Registers matching a search, in address order
+ * 
+ * Holds one bit per register_table entry, so it is small, copyable and never allocates.
+ */
+class RegisterSearchResult {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RegisterInfo;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const RegisterInfo*;
+        using reference = const RegisterInfo&;
+        
+        iterator() = default;
+        iterator(const std::bitset<register_table_size>* matches, size_t index) : matches_(matches), index_(index) { skip(); }
+        
+        reference operator*() const { return register_table[index_]; }
+        pointer operator->() const { return &register_table[index_]; }
+        iterator& operator++() { ++index_; skip(); return *this; }
+        iterator operator++(int) { auto old = *this; ++*this; return old; }
+        bool operator==(const iterator& other) const { return index_ == other.index_; }
+        
+    private:
+        void skip() {
+            while (index_ < register_table_size && !matches_->test(index_)) {
+                ++index_;
+            }
+        }
+        
+        const std::bitset<register_table_size>* matches_ = nullptr;
+        size_t index_ = register_table_size;
+    };
+    
+    explicit RegisterSearchResult(const std::bitset<register_table_size>& matches) : matches_(matches) {}
+    
+    iterator begin() const { return iterator(&matches_, 0); }
+    iterator end() const { return iterator(&matches_, register_table_size); }
+    size_t size() const { return matches_.count(); }
+    bool empty() const { return matches_.none(); }
+    
+    /**
+     * @brief Check whether a register_table entry matched
+     */
+    bool contains(size_t table_index) const { return matches_.test(table_index); }
+    
+private:
+    std::bitset<register_table_size> matches_;
+};
+
+/**
+ * @brief Search registers without allocating
+ * 
+ * Case-insensitive substring match against the generated lowercase names (and
+ * descriptions). The generated token index narrows the candidates to registers
+ * containing a token that contains the longest alphanumeric run of the pattern.
+ * 
+ * @param pattern Search pattern, empty matches all registers
+ * @param scope Fields to compare
+ * @return RegisterSearchResult Matching registers
+ */
+RegisterSearchResult search_registers(std::string_view pattern, RegisterSearchScope scope = RegisterSearchScope::name);
+
 /**
  * @brief Get the number of currently connected modules
  * 
@@ -218,6 +471,19 @@ std::optional<uint16_t> get_nominal_current(libmodbus_cpp::ModbusConnection& con
  */
 std::string print_device_info(libmodbus_cpp::ModbusConnection& conn);
 
+/**
+ * @brief Print device information within a time budget
+ *
+ * Stops issuing reads once the deadline has passed or a stop is requested. Values
+ * that were not read in time are reported as errors, everything read before is printed.
+ *
+ * @param conn MODBUS connection
+ * @param deadline Budget for all reads
+ * @param stop Cancels the remaining reads
+ * @return std::string Formatted device information
+ */
+std::string print_device_info(libmodbus_cpp::ModbusConnection& conn, Deadline deadline, std::stop_token stop = {});
+
 // ============================================================================
 // System Status and Monitoring Functions
 // ============================================================================
@@ -246,6 +512,123 @@ struct ChannelStatus {
     bool system_current_too_high;
 };
 
+/**
+ * @brief System measurements (0x6001-0x6009)
+ */
+struct SystemMeasurements {
+    uint16_t total_system_current;          // 0x6001, A
+    uint16_t input_voltage;                 // 0x6002, 0.01 V
+    uint16_t connected_modules;             // 0x6003
+    uint16_t connected_modules_at_boot;     // 0x6004
+    uint16_t sum_of_nominal_currents;       // 0x6005, A
+    uint16_t max_caparoc_bus_cycle_ms;      // 0x6006
+    uint16_t max_quint_power_bus_cycle_ms;  // 0x6007
+    uint16_t hours_since_last_boot;         // 0x6008
+    int16_t internal_temperature;           // 0x6009, °C
+};
+
+/**
+ * @brief Decoded contents of the status block (0x6000-0x60CF)
+ * 
+ * Per-channel arrays are indexed with channel_index(module_number, channel_number).
+ * Slots of modules or channels that are not connected hold whatever the device reports
+ * for them (normally zero).
+ */
+struct StatusSnapshot {
+    GlobalStatus global_status;                             // 0x6000
+    SystemMeasurements measurements;                        // 0x6001-0x6009
+    std::array<ChannelStatus, max_channels> channel_status; // 0x6010-0x604F
+    std::array<uint16_t, max_channels> load_current;        // 0x6050-0x608F, mA (resolution 100mA)
+    std::array<uint16_t, max_channels> error_counter;       // 0x6090-0x60CF
+};
+
+/// First address of the status block
+constexpr uint16_t status_block_address = 0x6000;
+
+/// Number of registers in the status block (0x6000-0x60CF)
+constexpr uint16_t status_block_size = 0x60D0 - status_block_address;
+
+/**
+ * @brief Decode a raw global status byte (0x6000)
+ * 
+ * @param value Raw register value
+ * @return GlobalStatus Decoded status bits
+ */
+GlobalStatus decode_global_status(uint16_t value);
+
+/**
+ * @brief Decode a raw channel status word (0x6010-0x604F)
+ * 
+ * @param value Raw register value
+ * @return ChannelStatus Decoded status bits
+ */
+ChannelStatus decode_channel_status(uint16_t value);
+
+/// Number of system measurement registers (0x6001-0x6009)
+constexpr uint16_t system_measurements_size = 0x600A - 0x6001;
+
+/**
+ * @brief Decode raw system measurements
+ * 
+ * @param values Register values 0x6001-0x6009
+ * @return SystemMeasurements Decoded measurements
+ */
+SystemMeasurements decode_system_measurements(std::span<const uint16_t, system_measurements_size> values);
+
+/**
+ * @brief Decode a raw image of the status block
+ * 
+ * @param block Register values 0x6000-0x60CF (status_block_size values, the unmapped
+ *              0x600A-0x600F are ignored)
+ * @return StatusSnapshot Decoded snapshot
+ */
+StatusSnapshot decode_status_snapshot(std::span<const uint16_t, status_block_size> block);
+
+/**
+ * @brief Read the complete status block (0x6000-0x60CF) with as few transactions as possible
+ * 
+ * Reads global status, system measurements, all 64 channel status words, load currents
+ * and error counters in three block reads instead of one read per value. The unmapped
+ * range 0x600A-0x600F is never requested.
+ * 
+ * @param conn MODBUS connection
+ * @return std::optional<StatusSnapshot> Decoded snapshot if all reads succeeded
+ */
+std::optional<StatusSnapshot> read_status_snapshot(libmodbus_cpp::ModbusConnection& conn);
+
+/**
+ * @brief Status snapshot that may be missing parts of the status block
+ *
+ * Fields of snapshot whose valid flag is not set are zero.
+ */
+struct PartialStatusSnapshot {
+    StatusSnapshot snapshot{};
+    bool header_valid = false;                      // global_status and measurements
+    std::bitset<max_channels> channel_status_valid;
+    std::bitset<max_channels> load_current_valid;
+    std::bitset<max_channels> error_counter_valid;
+
+    /**
+     * @brief Check whether the whole status block was read
+     */
+    bool complete() const {
+        return header_valid && channel_status_valid.all() && load_current_valid.all() && error_counter_valid.all();
+    }
+};
+
+/**
+ * @brief Read the status block within a time budget
+ *
+ * Issues the same block reads as read_status_snapshot() but stops once the deadline
+ * has passed, a stop is requested or a read fails, and returns what was read so far.
+ *
+ * @param conn MODBUS connection
+ * @param deadline Budget for all reads
+ * @param stop Cancels the remaining reads
+ * @return PartialStatusSnapshot Snapshot with validity flags per value
+ */
+PartialStatusSnapshot read_status_snapshot(libmodbus_cpp::ModbusConnection& conn, Deadline deadline, std::stop_token stop = {});
+
 /**
  * @brief Get global status byte (0x6000)
  * 
@@ -318,5 +701,324 @@ std::optional<uint16_t> get_load_current(libmodbus_cpp::ModbusConnection& conn,
  */
 bool control_channel(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number, bool on);
 
+// ============================================================================
+// Device Topology
+// ============================================================================
+
+/**
+ * @brief Cached module and channel counts (0x2000-0x2010)
+ * 
+ * Populated with a single block read and used to validate module and channel
+ * numbers locally, so accessors taking a DeviceTopology need no validation reads.
+ * The cache is invalidated explicitly with invalidate(), by the topology-aware
+ * accessors when a transaction fails, and by invalidate_if_changed() when a status
+ * snapshot reports a different number of connected modules. Invalidation handlers
+ * are notified whenever a valid topology becomes invalid.
+ */
+class DeviceTopology {
+public:
+    using InvalidationHandler = HandlerList<>::Handler;
+    
+    /**
+     * @brief Re-read module count and channel counts (0x2000-0x2010) in one transaction
+     * 
+     * @param conn MODBUS connection
+     * @return true if successful
+     * @return false if the read failed (the topology is invalid afterwards)
+     */
+    bool refresh(libmodbus_cpp::ModbusConnection& conn);
+    
+    /**
+     * @brief Refresh the topology if it is not valid
+     * 
+     * @param conn MODBUS connection
+     * @throws std::invalid_argument if the topology could not be read from the device
+     */
+    void ensure_valid(libmodbus_cpp::ModbusConnection& conn);
+    
+    /**
+     * @brief Mark the cached topology as stale and notify invalidation handlers
+     */
+    void invalidate();
+    
+    /**
+     * @brief Invalidate the cache if a snapshot reports a different module count (0x6003)
+     * 
+     * @param snapshot Recently read status snapshot
+     * @return true if the topology was invalidated
+     */
+    bool invalidate_if_changed(const StatusSnapshot& snapshot);
+    
+    bool valid() const { return valid_; }
+    
+    /**
+     * @brief Number of connected modules (0 if not valid)
+     */
+    uint16_t module_count() const { return module_count_; }
+    
+    /**
+     * @brief Number of channels of a connected module (0 if not valid or not connected)
+     * 
+     * @param module_number Module number (1-16)
+     */
+    uint16_t channel_count(uint8_t module_number) const;
+    
+    /**
+     * @brief Check whether a module/channel combination exists
+     * 
+     * @param module_number Module number (1-16)
+     * @param channel_number Channel number (1-4)
+     */
+    bool contains(uint8_t module_number, uint8_t channel_number) const;
+    
+    /**
+     * @brief Channel slots (see channel_index()) of all existing channels
+     */
+    std::bitset<max_channels> channel_mask() const;
+    
+    /**
+     * @brief Validate a module number against the cached module count
+     * 
+     * @throws std::invalid_argument if module_number is out of range or the topology is not valid
+     */
+    void validate_module_number(uint8_t module_number) const;
+    
+    /**
+     * @brief Validate a channel number against the cached channel count of a module
+     * 
+     * @throws std::invalid_argument if channel_number is out of range or the topology is not valid
+     */
+    void validate_channel_number(uint8_t module_number, uint8_t channel_number) const;
+    
+    /**
+     * @brief Register a handler called whenever the topology is invalidated
+     * 
+     * Handlers may add or remove handlers. A handler removed during a notification is
+     * not called for it, a handler added during a notification is called from the next one.
+     * 
+     * @return size_t Handle for remove_invalidation_handler()
+     */
+    size_t add_invalidation_handler(InvalidationHandler handler);
+    
+    void remove_invalidation_handler(size_t handle);
+
+private:
+    bool valid_ = false;
+    uint16_t module_count_ = 0;
+    std::array<uint16_t, max_modules> channel_counts_{};
+    HandlerList<> handlers_;
+};
+
+/**
+ * @brief Get product name for a specific module, validated against a cached topology
+ * 
+ * @param conn MODBUS connection
+ * @param topology Cached topology, refreshed if not valid
+ * @param module_number Module number (1-16)
+ * @return std::optional<std::string> Product name if successful
+ * @throws std::invalid_argument if module_number is out of range
+ */
+std::optional<std::string> get_product_name_module(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number);
+
+/**
+ * @brief Set nominal current for a module channel, validated against a cached topology
+ * 
+ * @see set_nominal_current(libmodbus_cpp::ModbusConnection&, uint8_t, uint8_t, uint16_t)
+ * @throws std::invalid_argument if module_number or channel_number are out of valid range
+ */
+bool set_nominal_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number, uint16_t nominal_current);
+
+/**
+ * @brief Get nominal current for a module channel, validated against a cached topology
+ * 
+ * @throws std::invalid_argument if module_number or channel_number are out of valid range
+ */
+std::optional<uint16_t> get_nominal_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+
+/**
+ * @brief Get channel status, validated against a cached topology
+ * 
+ * @throws std::invalid_argument if module_number or channel_number are out of valid range
+ */
+std::optional<ChannelStatus> get_channel_status(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+
+/**
+ * @brief Get actual load current for a channel, validated against a cached topology
+ * 
+ * @throws std::invalid_argument if module_number or channel_number are out of valid range
+ */
+std::optional<uint16_t> get_load_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+
+/**
+ * @brief Control channel on/off, validated against a cached topology
+ * 
+ * @throws std::invalid_argument if module_number or channel_number are out of valid range
+ */
+bool control_channel(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number, bool on);
+
+// ============================================================================
+// Inventory Functions
+// ============================================================================
+
+/**
+ * @brief Identification strings of one device (0x1000-0x19FF)
+ */
+struct ProductInfo {
+    std::string product_name;      // 0x1000 block
+    std::string product_id;        // 0x1200 block (order number for modules)
+    std::string serial_number;     // 0x1400 block
+    std::string hardware_version;  // 0x1600 block
+    std::string firmware_version;  // 0x1800 block
+};
+
+/**
+ * @brief Identification of the power module, all connected modules and the QUINT power supply
+ */
+struct DeviceInventory {
+    ProductInfo power_module;
+    uint16_t module_count;
+    std::array<uint16_t, max_modules> channel_counts;  // only [0, module_count) are populated
+    std::array<ProductInfo, max_modules> modules;      // only [0, module_count) are populated
+    ProductInfo quint;
+};
+
+/**
+ * @brief Read the complete inventory with large block reads
+ * 
+ * Reads the module count once and then all product name, ID, serial number,
+ * hardware and firmware strings of the power module, the connected modules and
+ * the QUINT power supply, packing up to 7 strings into one request. Slots of
+ * modules that are not connected are not read.
+ * 
+ * @param conn MODBUS connection
+ * @return std::optional<DeviceInventory> Inventory if all reads succeeded
+ */
+std::optional<DeviceInventory> read_inventory(libmodbus_cpp::ModbusConnection& conn);
+
+/**
+ * @brief Read the complete inventory using a cached topology for the module count
+ * 
+ * @param conn MODBUS connection
+ * @param topology Cached topology, refreshed if not valid
+ * @return std::optional<DeviceInventory> Inventory if all reads succeeded
+ */
+std::optional<DeviceInventory> read_inventory(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology);
+
+// ============================================================================
+// Batched Parametrization Functions
+// ============================================================================
+
+/**
+ * @brief Nominal current setting for one channel
+ */
+struct NominalAssignment {
+    uint8_t module_number;    // 1-16
+    uint8_t channel_number;   // 1-4
+    uint16_t nominal_current; // Amperes
+};
+
+/**
+ * @brief Set nominal currents of many channels in one lock/unlock sequence
+ * 
+ * Waits for the bus cycle once, unlocks the affected channel locks (0xC090-0xC0CF)
+ * and the global lock (0xC001), writes the nominal currents (0xC050-0xC08F) with
+ * one request per contiguous run of connected channels, verifies them with a single
+ * block read-back and relocks. Unaffected channels inside a run are rewritten with
+ * their current value and get their previous lock state back. If several
+ * assignments target the same channel, the last one wins.
+ * 
+ * @param conn MODBUS connection
+ * @param assignments Channels and their new nominal currents
+ * @return true if all values were written and verified
+ * @return false if a transaction failed or verification did not succeed
+ * @throws std::invalid_argument if a module or channel number is out of range, or a
+ *         module is a CAPAROC E2 12-24DC/2-10A (rotary dial only)
+ */
+bool apply_nominal_currents(libmodbus_cpp::ModbusConnection& conn, std::span<const NominalAssignment> assignments);
+
+/**
+ * @brief Set nominal currents of many channels, validated against a cached topology
+ * 
+ * @see apply_nominal_currents(libmodbus_cpp::ModbusConnection&, std::span<const NominalAssignment>)
+ */
+bool apply_nominal_currents(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, std::span<const NominalAssignment> assignments);
+
+// ============================================================================
+// Channel Switching Functions
+// ============================================================================
+
+/**
+ * @brief Options for set_channel_states()
+ */
+struct ChannelSwitchOptions {
+    /// Channel slots (see channel_index()) to switch, all other channels are left as they are
+    std::bitset<max_channels> mask = std::bitset<max_channels>{}.set();
+    
+    /// Switch channels on one at a time, waiting SWITCH_ON_DELAY_BETWEEN_CHANNELS (0xC000) between them
+    bool staggered_switch_on = false;
+};
+
+/**
+ * @brief Read the on/off state of all channels (0xC010-0xC04F) in one transaction
+ * 
+ * @param conn MODBUS connection
+ * @return std::optional<std::bitset<max_channels>> Bit channel_index() is set if the channel is on
+ */
+std::optional<std::bitset<max_channels>> get_channel_states(libmodbus_cpp::ModbusConnection& conn);
+
+/**
+ * @brief Switch many channels on/off with as few writes as possible
+ * 
+ * Reads the control block (0xC010-0xC04F) once and writes only channels whose
+ * state differs, one request per contiguous run of connected channels. Channels
+ * between two changed ones in a run are rewritten with their current state.
+ * With staggered_switch_on, channels are first switched off in bulk and then
+ * switched on individually in ascending order with the device's switch-on delay
+ * between them, so large loads are energised in a controlled order.
+ * 
+ * @param conn MODBUS connection
+ * @param states Desired state per channel slot (see channel_index()), set means on
+ * @param options Channels to consider and switch-on pacing
+ * @return true if all writes succeeded
+ * @return false if a transaction failed
+ */
+bool set_channel_states(libmodbus_cpp::ModbusConnection& conn, const std::bitset<max_channels>& states, const ChannelSwitchOptions& options = {});
+
+/**
+ * @brief Switch many channels on/off, using a cached topology for the connected channels
+ * 
+ * @see set_channel_states(libmodbus_cpp::ModbusConnection&, const std::bitset<max_channels>&, const ChannelSwitchOptions&)
+ */
+bool set_channel_states(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, const std::bitset<max_channels>& states, const ChannelSwitchOptions& options = {});
+
+// ============================================================================
+// Configuration Functions
+// ============================================================================
+
+/**
+ * @brief Contents of the configuration block (0xC000-0xC0CF)
+ * 
+ * Per-channel members are indexed with channel_index(module_number, channel_number).
+ */
+struct DeviceConfiguration {
+    uint16_t switch_on_delay;                             // 0xC000, ms
+    bool nominal_current_lock;                            // 0xC001
+    bool local_user_interface_lock;                       // 0xC002
+    std::bitset<max_channels> channel_on;                 // 0xC010-0xC04F
+    std::array<uint16_t, max_channels> nominal_current;   // 0xC050-0xC08F, A
+    std::bitset<max_channels> channel_lock;               // 0xC090-0xC0CF
+};
+
+/**
+ * @brief Read the complete configuration block (0xC000-0xC0CF) with as few transactions as possible
+ * 
+ * Reads the global settings and all channel control, nominal current and lock
+ * registers in three block reads. The unmapped range 0xC003-0xC00F is never requested.
+ * 
+ * @param conn MODBUS connection
+ * @return std::optional<DeviceConfiguration> Configuration if all reads succeeded
+ */
+std::optional<DeviceConfiguration> read_configuration(libmodbus_cpp::ModbusConnection& conn);
+
 } // namespace v1
 } // namespace caparoc
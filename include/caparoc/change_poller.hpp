@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <functional>
+#include <optional>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/handler_list.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Change Detection
+// ============================================================================
+
+/**
+ * @brief Bits of the global status byte (0x6000)
+ */
+enum class GlobalStatusBit : uint8_t {
+    undervoltage,
+    overvoltage,
+    cumulative_channel_error,
+    cumulative_80_warning,
+    system_current_too_high
+};
+
+/**
+ * @brief Bits of a channel status word (0x6010-0x604F)
+ */
+enum class ChannelStatusBit : uint8_t {
+    warning_80_percent,
+    overload,
+    short_circuit,
+    hardware_error,
+    voltage_error,
+    module_current_too_high,
+    system_current_too_high
+};
+
+/**
+ * @brief Polls status snapshots and reports only what changed
+ * 
+ * Keeps the previous snapshot and calls the registered handlers for edges of
+ * individual status bits, load-current changes beyond a per-channel deadband and
+ * changes of the connected module count (0x6003). The first snapshot after
+ * construction or reset() only establishes the baseline and emits nothing.
+ */
+class ChangePoller {
+public:
+    using GlobalStatusHandler = std::function<void(GlobalStatusBit bit, bool value)>;
+    using ChannelStatusHandler = std::function<void(uint8_t module_number, uint8_t channel_number, ChannelStatusBit bit, bool value)>;
+    using LoadCurrentHandler = std::function<void(uint8_t module_number, uint8_t channel_number, uint16_t previous, uint16_t current)>;
+    using ModuleCountHandler = std::function<void(uint16_t previous, uint16_t current)>;
+    
+    // Handlers may register further handlers, which are called from the next change on
+    
+    void on_global_status_change(GlobalStatusHandler handler);
+    void on_channel_status_change(ChannelStatusHandler handler);
+    void on_load_current_change(LoadCurrentHandler handler);
+    void on_module_count_change(ModuleCountHandler handler);
+    
+    /**
+     * @brief Set the load-current deadband of all channels
+     * 
+     * @param deadband_ma Changes up to this many mA (relative to the last reported value) are suppressed
+     */
+    void set_load_current_deadband(uint16_t deadband_ma);
+    
+    /**
+     * @brief Set the load-current deadband of one channel
+     * 
+     * @param module_number Module number (1-16)
+     * @param channel_number Channel number (1-4)
+     * @param deadband_ma Changes up to this many mA (relative to the last reported value) are suppressed
+     */
+    void set_load_current_deadband(uint8_t module_number, uint8_t channel_number, uint16_t deadband_ma);
+    
+    /**
+     * @brief Read a status snapshot and emit the changes
+     * 
+     * @param conn MODBUS connection
+     * @return true if the snapshot was read
+     * @return false if the read failed (the previous snapshot is kept)
+     */
+    bool poll(libmodbus_cpp::ModbusConnection& conn);
+    
+    /**
+     * @brief Compare a snapshot obtained elsewhere against the previous one and emit the changes
+     * 
+     * @param snapshot Current snapshot, becomes the new baseline
+     */
+    void process(const StatusSnapshot& snapshot);
+    
+    /**
+     * @brief Forget the previous snapshot, the next one is a new baseline
+     */
+    void reset();
+    
+    /**
+     * @brief The most recently processed snapshot
+     */
+    const std::optional<StatusSnapshot>& previous() const { return previous_; }
+
+private:
+    std::optional<StatusSnapshot> previous_;
+    std::array<uint16_t, max_channels> reported_load_current_{};
+    std::array<uint16_t, max_channels> deadband_{};
+    HandlerList<GlobalStatusBit, bool> global_status_handlers_;
+    HandlerList<uint8_t, uint8_t, ChannelStatusBit, bool> channel_status_handlers_;
+    HandlerList<uint8_t, uint8_t, uint16_t, uint16_t> load_current_handlers_;
+    HandlerList<uint16_t, uint16_t> module_count_handlers_;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Event Loop
+// ============================================================================
+
+/**
+ * @brief Single-threaded epoll event loop with timers (Linux only)
+ * 
+ * File descriptor handlers, timers and posted functions all run on the thread
+ * calling run() or run_once(). Only post() and stop() may be called from other threads.
+ */
+class EventLoop {
+public:
+    using clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+    
+    /// Called with the epoll event mask (EPOLLIN, EPOLLOUT, EPOLLERR, ...)
+    using FdHandler = std::function<void(uint32_t events)>;
+    
+    EventLoop();
+    ~EventLoop();
+    
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    
+    /**
+     * @brief Watch a file descriptor
+     * 
+     * @param fd File descriptor, it stays owned by the caller
+     * @param events epoll events to watch
+     * @param handler Called when any of the events occur
+     * @throws std::system_error if epoll rejects the descriptor
+     */
+    void add_fd(int fd, uint32_t events, FdHandler handler);
+    
+    /**
+     * @brief Change the watched events of a file descriptor
+     */
+    void modify_fd(int fd, uint32_t events);
+    
+    /**
+     * @brief Stop watching a file descriptor (safe to call from its own handler)
+     */
+    void remove_fd(int fd);
+    
+    /**
+     * @brief Call a function once at the given time
+     * 
+     * @return TimerId Handle for cancel_timer()
+     */
+    TimerId add_timer(clock::time_point when, std::function<void()> fn);
+    
+    /**
+     * @brief Call a function once after the given delay
+     */
+    TimerId add_timer(clock::duration delay, std::function<void()> fn) { return add_timer(clock::now() + delay, std::move(fn)); }
+    
+    /**
+     * @brief Cancel a pending timer (no effect if it already fired)
+     */
+    void cancel_timer(TimerId id);
+    
+    /**
+     * @brief Call a function on the loop thread during the next iteration (thread-safe)
+     */
+    void post(std::function<void()> fn);
+    
+    /**
+     * @brief Wait for events at most max_wait and dispatch them, due timers and posted functions
+     */
+    void run_once(std::chrono::milliseconds max_wait = std::chrono::milliseconds(1000));
+    
+    /**
+     * @brief Dispatch events until stop() is called
+     */
+    void run();
+    
+    /**
+     * @brief Make run() return after the current iteration (thread-safe)
+     */
+    void stop();
+
+private:
+    struct Watch {
+        int fd;
+        FdHandler handler;
+    };
+    
+    struct TimerEntry {
+        clock::time_point when;
+        TimerId id;
+        bool operator>(const TimerEntry& other) const { return when > other.when; }
+    };
+    
+    void wake();
+    void run_posted();
+    void run_timers();
+    
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    std::atomic<bool> stopped_ = false;
+    
+    // Registrations are keyed by id, so events of removed descriptors are dropped
+    uint64_t next_watch_ = 1;
+    std::unordered_map<uint64_t, std::shared_ptr<Watch>> watches_;
+    std::unordered_map<int, uint64_t> watch_by_fd_;
+    
+    TimerId next_timer_ = 1;
+    std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<>> timer_queue_;
+    std::unordered_map<TimerId, std::function<void()>> timers_;
+    
+    std::mutex posted_mutex_;
+    std::vector<std::function<void()>> posted_;
+};
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
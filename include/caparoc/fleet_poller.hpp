@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/event_loop.hpp"
+#include "caparoc/modbus_tcp_session.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Fleet Polling
+// ============================================================================
+
+/**
+ * @brief Options for FleetPoller
+ */
+struct FleetPollerOptions {
+    /// Interval between two snapshots of the same device
+    std::chrono::milliseconds period{1000};
+    
+    /// Wait before reconnecting after a failed connect or a broken connection
+    std::chrono::milliseconds reconnect_delay{5000};
+    
+    /// Upper bound for simultaneous connection attempts, avoids SYN bursts at start-up
+    size_t max_concurrent_connects = 64;
+    
+    SessionOptions session;
+};
+
+/**
+ * @brief Connection state of one device
+ */
+enum class DeviceState {
+    disconnected,  // waiting for the next tick to connect
+    connecting,
+    idle,          // connected, waiting for the next tick
+    polling,       // snapshot reads outstanding
+    backoff        // waiting for reconnect_delay after an error
+};
+
+/**
+ * @brief Polls the status block of many devices from one EventLoop
+ * 
+ * Every device has its own MODBUS/TCP session and state machine (connect, request,
+ * timeout). Device ticks are spread evenly over the period, so requests do not
+ * arrive in bursts. The block reads of a snapshot are issued together, so sessions
+ * with FleetPollerOptions::session.max_outstanding > 1 pipeline them. A tick that
+ * finds the previous snapshot still outstanding is counted as an overrun and skipped.
+ */
+class FleetPoller {
+public:
+    using SnapshotHandler = std::function<void(size_t device, const StatusSnapshot& snapshot)>;
+    using ErrorHandler = std::function<void(size_t device, std::error_code error)>;
+    
+    struct Statistics {
+        uint64_t snapshots = 0;
+        uint64_t errors = 0;
+        uint64_t overruns = 0;
+        uint64_t connects = 0;
+    };
+    
+    explicit FleetPoller(EventLoop& loop, FleetPollerOptions options = {});
+    ~FleetPoller();
+    
+    FleetPoller(const FleetPoller&) = delete;
+    FleetPoller& operator=(const FleetPoller&) = delete;
+    
+    /**
+     * @brief Add a device
+     * 
+     * @param host IP address or host name
+     * @param port TCP port
+     * @return size_t Device index passed to the handlers
+     */
+    size_t add_device(std::string host, uint16_t port = 502);
+    
+    /**
+     * @brief Called for every decoded snapshot
+     */
+    void on_snapshot(SnapshotHandler handler) { snapshot_handler_ = std::move(handler); }
+    
+    /**
+     * @brief Called for every failed connect or read
+     */
+    void on_error(ErrorHandler handler) { error_handler_ = std::move(handler); }
+    
+    /**
+     * @brief Start polling (the loop must be run by the caller)
+     */
+    void start();
+    
+    /**
+     * @brief Stop polling and close all connections
+     */
+    void stop();
+    
+    size_t device_count() const { return devices_.size(); }
+    DeviceState state(size_t device) const { return devices_.at(device)->state; }
+    const Statistics& statistics() const { return statistics_; }
+
+private:
+    struct Device {
+        size_t index;
+        std::unique_ptr<ModbusTcpSession> session;
+        DeviceState state = DeviceState::disconnected;
+        EventLoop::TimerId tick_timer = 0;
+        EventLoop::TimerId backoff_timer = 0;
+        EventLoop::clock::time_point next_tick;
+        uint64_t generation = 0;  // responses of abandoned polls are ignored
+        size_t remaining = 0;
+        std::array<uint16_t, status_block_size> block{};
+    };
+    
+    void tick(Device& device);
+    void connect(Device& device);
+    void poll(Device& device);
+    void fail(Device& device, std::error_code error);
+    
+    EventLoop& loop_;
+    FleetPollerOptions options_;
+    std::vector<std::unique_ptr<Device>> devices_;
+    SnapshotHandler snapshot_handler_;
+    ErrorHandler error_handler_;
+    Statistics statistics_;
+    size_t connecting_ = 0;
+    bool running_ = false;
+};
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <variant>
+#include "caparoc/caparoc.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Fleet Scanning
+// ============================================================================
+
+/**
+ * @brief Kind of work performed on a device
+ */
+enum class ScanJob {
+    inventory,      // read_inventory()
+    snapshot,       // read_status_snapshot()
+    configuration   // read_configuration()
+};
+
+/**
+ * @brief Outcome of one job
+ */
+struct ScanResult {
+    size_t device;
+    ScanJob job;
+    
+    /// Result of the job, std::monostate if connecting or reading failed
+    std::variant<std::monostate, DeviceInventory, StatusSnapshot, DeviceConfiguration> data;
+    
+    /// Time spent on the job including connecting
+    std::chrono::steady_clock::duration duration;
+    
+    bool ok() const { return !std::holds_alternative<std::monostate>(data); }
+};
+
+/**
+ * @brief Runs blocking jobs on many devices in parallel
+ * 
+ * Jobs run on a work-stealing thread pool whose size is the concurrency cap. Each
+ * device runs at most one job at a time, so its connection is never used by two
+ * threads at once. A device prefers the same worker thread but idle workers steal
+ * it. Results are delivered as soon as they complete; the result handler runs on
+ * the worker threads, but never concurrently with itself.
+ */
+class FleetScanner {
+public:
+    /// Opens a connection to a device, nullptr if that fails
+    using ConnectionFactory = std::function<std::unique_ptr<libmodbus_cpp::ModbusConnection>()>;
+    
+    using ResultHandler = std::function<void(const ScanResult& result)>;
+    
+    /**
+     * @param concurrency Number of worker threads, i.e. devices served at the same time
+     */
+    explicit FleetScanner(size_t concurrency = std::max(std::thread::hardware_concurrency(), 4u));
+    
+    /**
+     * @brief Finish all submitted jobs and stop the workers
+     */
+    ~FleetScanner();
+    
+    FleetScanner(const FleetScanner&) = delete;
+    FleetScanner& operator=(const FleetScanner&) = delete;
+    
+    /**
+     * @brief Add a device, its connection is opened on a worker when its first job runs
+     * 
+     * A connection is dropped after a failed job and opened again for the next one.
+     * 
+     * @param factory Opens the connection
+     * @return size_t Device index reported in results
+     */
+    size_t add_device(ConnectionFactory factory);
+    
+    /**
+     * @brief Set the result handler (before submitting jobs)
+     */
+    void on_result(ResultHandler handler);
+    
+    /**
+     * @brief Queue a job for one device, jobs of a device run in submission order
+     */
+    void submit(size_t device, ScanJob job);
+    
+    /**
+     * @brief Queue a job for every device
+     */
+    void submit_all(ScanJob job);
+    
+    /**
+     * @brief Block until all submitted jobs have completed
+     */
+    void wait();
+    
+    size_t device_count() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Handler Lists
+// ============================================================================
+
+/**
+ * @brief Callbacks with removal handles that may change the list while being called
+ *
+ * notify() calls a copy of the list, so handlers may add or remove handlers. A handler
+ * removed during a notification is not called for it, a handler added during a
+ * notification is called from the next one.
+ */
+template <typename... Args>
+class HandlerList {
+public:
+    using Handler = std::function<void(Args...)>;
+
+    /**
+     * @return size_t Handle for remove()
+     */
+    size_t add(Handler handler) {
+        const size_t handle = next_handle_++;
+        handlers_.emplace_back(handle, std::move(handler));
+        return handle;
+    }
+
+    void remove(size_t handle) {
+        std::erase_if(handlers_, [handle](const auto& entry) { return entry.first == handle; });
+    }
+
+    bool empty() const { return handlers_.empty(); }
+
+    /**
+     * @brief Call every handler registered when the notification starts
+     */
+    void notify(Args... args) const {
+        if (handlers_.empty()) {
+            return;
+        }
+        const auto handlers = handlers_;
+        for (const auto& [handle, handler] : handlers) {
+            if (contains(handle)) {
+                handler(args...);
+            }
+        }
+    }
+
+private:
+    bool contains(size_t handle) const {
+        return std::ranges::any_of(handlers_, [handle](const auto& entry) { return entry.first == handle; });
+    }
+
+    std::vector<std::pair<size_t, Handler>> handlers_;
+    size_t next_handle_ = 0;
+};
+
+} // namespace v1
+} // namespace caparoc
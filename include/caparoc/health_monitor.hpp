@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <chrono>
+#include <optional>
+#include "caparoc/caparoc.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Health Monitoring
+// ============================================================================
+
+/**
+ * @brief Options for HealthMonitor
+ */
+struct HealthMonitorOptions {
+    /// Re-read channel status at this interval while a cumulative bit stays set (zero: only when a bit flips)
+    std::chrono::milliseconds channel_status_refresh{0};
+};
+
+/**
+ * @brief Result of one HealthMonitor poll
+ * 
+ * Per-channel arrays are indexed with channel_index(module_number, channel_number) and
+ * only cover the connected modules.
+ */
+struct HealthReport {
+    GlobalStatus global_status;                             // 0x6000
+    SystemMeasurements measurements;                        // 0x6001-0x6009
+    
+    /// Latest channel status; all clear while neither cumulative bit is set
+    std::array<ChannelStatus, max_channels> channel_status;
+    
+    /// Latest load currents in mA, only valid while load_current_valid is set
+    std::array<uint16_t, max_channels> load_current;
+    bool load_current_valid;
+    
+    /// The poll read the channel status block (0x6010-0x604F)
+    bool channel_status_updated;
+    
+    /// The poll read the load current block (0x6050-0x608F)
+    bool load_current_updated;
+};
+
+/**
+ * @brief Adaptive monitor that drills down from the global status byte
+ * 
+ * Each poll reads the global status and system measurements (0x6000-0x6009) in a
+ * single request. The channel status block is only read when cumulative_channel_error
+ * or cumulative_80_warning flips (and optionally periodically while one of them is set).
+ * Load currents are only read while cumulative_80_warning or system_current_too_high is
+ * set. In the steady state a poll costs one request of 10 registers.
+ */
+class HealthMonitor {
+public:
+    using clock = std::chrono::steady_clock;
+    
+    explicit HealthMonitor(HealthMonitorOptions options = {});
+    
+    /**
+     * @brief Read the global status and drill down as needed
+     * 
+     * @param conn MODBUS connection
+     * @param now Current time, used for the periodic channel status refresh
+     * @return std::optional<HealthReport> Report if all required reads succeeded
+     */
+    std::optional<HealthReport> poll(libmodbus_cpp::ModbusConnection& conn, clock::time_point now = clock::now());
+    
+    /**
+     * @brief Latest report (valid after the first successful poll)
+     */
+    const HealthReport& report() const { return report_; }
+    
+    /**
+     * @brief Forget all state, the next poll behaves like the first one
+     */
+    void reset();
+
+private:
+    HealthMonitorOptions options_;
+    HealthReport report_{};
+    bool initialized_ = false;
+    clock::time_point last_channel_status_read_{};
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <optional>
+#include <span>
+#include <string>
+#include <system_error>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// MODBUS/TCP Framing
+// ============================================================================
+
+/// Size of the MBAP header (transaction id, protocol id, length, unit id)
+constexpr size_t mbap_header_size = 7;
+
+/// Largest MODBUS/TCP application data unit
+constexpr size_t max_adu_size = 260;
+
+/// Unit identifier used by libmodbus for MODBUS/TCP (MODBUS_TCP_SLAVE)
+constexpr uint8_t default_unit_id = 0xFF;
+
+/**
+ * @brief Function codes used by the library
+ */
+enum class FunctionCode : uint8_t {
+    read_holding_registers = 0x03,
+    write_single_register = 0x06,
+    write_multiple_registers = 0x10
+};
+
+/**
+ * @brief One encoded request
+ */
+struct Frame {
+    std::array<uint8_t, max_adu_size> data{};
+    size_t size = 0;
+
+    std::span<const uint8_t> bytes() const { return std::span(data).first(size); }
+};
+
+/**
+ * @brief Encode a read holding registers request (FC 0x03)
+ * 
+ * @throws std::invalid_argument if count is 0 or exceeds max_read_registers
+ */
+Frame encode_read_holding_registers(uint16_t transaction_id, uint8_t unit_id, uint16_t address, uint16_t count);
+
+/**
+ * @brief Encode a write single register request (FC 0x06)
+ */
+Frame encode_write_single_register(uint16_t transaction_id, uint8_t unit_id, uint16_t address, uint16_t value);
+
+/**
+ * @brief Encode a write multiple registers request (FC 0x10)
+ * 
+ * @throws std::invalid_argument if values is empty or exceeds max_write_registers
+ */
+Frame encode_write_multiple_registers(uint16_t transaction_id, uint8_t unit_id, uint16_t address, std::span<const uint16_t> values);
+
+/**
+ * @brief Determine the size of the first ADU in a receive buffer
+ * 
+ * @param buffer Received bytes
+ * @return std::optional<size_t> Size of the complete ADU, 0 if more bytes are needed,
+ *         std::nullopt if the header is malformed
+ */
+std::optional<size_t> frame_size(std::span<const uint8_t> buffer);
+
+/**
+ * @brief Decoded response header, the payload refers to the receive buffer
+ */
+struct Response {
+    uint16_t transaction_id;
+    uint8_t unit_id;
+    uint8_t function;        // without the exception flag (0x80)
+    uint8_t exception_code;  // 0 for regular responses
+    std::span<const uint8_t> payload;  // PDU after the function code
+};
+
+/**
+ * @brief Parse one complete ADU
+ * 
+ * @param adu Bytes of exactly one ADU as determined by frame_size()
+ * @return std::optional<Response> Response if the ADU is well-formed
+ */
+std::optional<Response> parse_response(std::span<const uint8_t> adu);
+
+/**
+ * @brief Extract the register values of a read holding registers response
+ * 
+ * @param response Parsed response
+ * @param values Output, its size must match the requested count
+ * @return true if the response carries exactly values.size() registers
+ */
+bool decode_read_response(const Response& response, std::span<uint16_t> values);
+
+/**
+ * @brief Check that a write response echoes the request
+ * 
+ * @param response Parsed response
+ * @param address Written address
+ * @param value Written value (FC 0x06) or number of written registers (FC 0x10)
+ */
+bool check_write_response(const Response& response, uint16_t address, uint16_t value);
+
+// ============================================================================
+// Errors
+// ============================================================================
+
+/**
+ * @brief Errors reported by asynchronous transactions
+ * 
+ * Values 1-11 are the MODBUS exception codes returned by the device.
+ */
+enum class ModbusErrc {
+    illegal_function = 0x01,
+    illegal_data_address = 0x02,
+    illegal_data_value = 0x03,
+    server_device_failure = 0x04,
+    acknowledge = 0x05,
+    server_device_busy = 0x06,
+    memory_parity_error = 0x08,
+    gateway_path_unavailable = 0x0A,
+    gateway_target_failed = 0x0B,
+    not_connected = 0x100,
+    timeout,
+    connection_closed,
+    protocol_error,
+    cancelled
+};
+
+const std::error_category& modbus_category() noexcept;
+
+std::error_code make_error_code(ModbusErrc errc) noexcept;
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
+
+template <>
+struct std::is_error_code_enum<caparoc::async::ModbusErrc> : std::true_type {};
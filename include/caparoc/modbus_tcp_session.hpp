@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "caparoc/event_loop.hpp"
+#include "caparoc/modbus_tcp.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Non-Blocking MODBUS/TCP Session
+// ============================================================================
+
+/**
+ * @brief Options for ModbusTcpSession
+ */
+struct SessionOptions {
+    std::chrono::milliseconds connect_timeout{3000};
+    
+    /// Time from sending a request until its response must have arrived
+    std::chrono::milliseconds request_timeout{1000};
+    
+    uint8_t unit_id = default_unit_id;
+    
+    /// Largest number of requests sent before their responses arrived (1: strict request/response)
+    size_t max_outstanding = 1;
+    
+    /// Matched responses in strict request/response mode before pipelining is tried again (0: never)
+    size_t pipelining_retry_after = 100;
+};
+
+/**
+ * @brief MODBUS/TCP client connection driven by an EventLoop
+ * 
+ * Requests are queued and sent one at a time, or with SessionOptions::max_outstanding
+ * greater than 1, pipelined: up to that many requests are sent before their responses
+ * arrive, and responses are matched by transaction id. If the device misbehaves while
+ * pipelining (a response with an unknown transaction id, or a request timing out),
+ * the session falls back to strict request/response. Pipelining is tried again on the
+ * next connect, or after SessionOptions::pipelining_retry_after matched responses.
+ * Callbacks are always invoked from the event loop, never from within the call that
+ * issued the request. A session must
+ * not be destroyed from one of its own callbacks; pending callbacks are dropped
+ * without being invoked when the session is destroyed.
+ */
+class ModbusTcpSession {
+public:
+    using ConnectCallback = std::function<void(std::error_code error)>;
+    using ReadCallback = std::function<void(std::error_code error, std::span<const uint16_t> values)>;
+    using WriteCallback = std::function<void(std::error_code error)>;
+    
+    /**
+     * @param loop Event loop driving the session, it must outlive the session
+     * @param host IP address or host name (host names are resolved synchronously)
+     * @param port TCP port
+     * @param options Timeouts and unit id
+     */
+    ModbusTcpSession(EventLoop& loop, std::string host, uint16_t port = 502, SessionOptions options = {});
+    ~ModbusTcpSession();
+    
+    ModbusTcpSession(const ModbusTcpSession&) = delete;
+    ModbusTcpSession& operator=(const ModbusTcpSession&) = delete;
+    
+    /**
+     * @brief Open the connection
+     * 
+     * Requests issued while connecting are sent once the connection is established.
+     * 
+     * @param callback Called with the outcome
+     */
+    void connect(ConnectCallback callback);
+    
+    /**
+     * @brief Close the connection, pending requests fail with ModbusErrc::cancelled
+     */
+    void close();
+    
+    bool connected() const { return state_ == State::connected; }
+    bool connecting() const { return state_ == State::connecting; }
+    
+    /**
+     * @brief Number of queued and outstanding requests
+     */
+    size_t pending() const { return queue_.size() + in_flight_.size(); }
+    
+    /**
+     * @brief Current number of requests that may be outstanding at once
+     */
+    size_t window() const { return pipelining_ ? options_.max_outstanding : 1; }
+    
+    /**
+     * @brief Read holding registers (FC 0x03)
+     * 
+     * @param address First register
+     * @param count Number of registers (1 to max_read_registers)
+     * @param callback Called with the values, which are only valid during the call
+     */
+    void read_registers(uint16_t address, uint16_t count, ReadCallback callback);
+    
+    /**
+     * @brief Write a single register (FC 0x06)
+     */
+    void write_register(uint16_t address, uint16_t value, WriteCallback callback);
+    
+    /**
+     * @brief Write consecutive registers (FC 0x10)
+     * 
+     * @param address First register
+     * @param values Values (1 to max_write_registers), copied before the call returns
+     * @param callback Called with the outcome
+     */
+    void write_registers(uint16_t address, std::span<const uint16_t> values, WriteCallback callback);
+    
+    EventLoop& loop() { return loop_; }
+    const std::string& host() const { return host_; }
+    uint16_t port() const { return port_; }
+
+private:
+    enum class State { disconnected, connecting, connected };
+    
+    struct Pending {
+        uint16_t transaction_id;
+        FunctionCode function;
+        uint16_t address;
+        uint16_t expected;  // register count for reads, echoed value or count for writes
+        Frame frame;
+        ReadCallback callback;
+        EventLoop::TimerId timer = 0;
+    };
+    
+    void enqueue(FunctionCode function, uint16_t address, uint16_t expected, Frame frame, ReadCallback callback);
+    void fail_later(ReadCallback callback, std::error_code error);
+    void fail_connection_later(std::error_code error);
+    void on_events(uint32_t events);
+    void on_connected();
+    void on_readable();
+    void on_response(const Response& response);
+    void on_timeout(uint16_t transaction_id);
+    void disable_pipelining();
+    void send_next();
+    void flush();
+    void complete(Pending pending, std::error_code error, std::span<const uint16_t> values);
+    void disconnect(std::error_code error);
+    
+    EventLoop& loop_;
+    std::string host_;
+    uint16_t port_;
+    SessionOptions options_;
+    
+    State state_ = State::disconnected;
+    int fd_ = -1;
+    ConnectCallback connect_callback_;
+    EventLoop::TimerId connect_timer_ = 0;
+    EventLoop::TimerId failure_timer_ = 0;  // disconnects after a failed send, from the event loop
+    
+    uint16_t next_transaction_id_ = 1;
+    std::deque<Pending> queue_;
+    std::deque<Pending> in_flight_;
+    bool pipelining_ = true;
+    size_t clean_responses_ = 0;  // matched responses since pipelining was disabled
+    
+    std::vector<uint8_t> out_;
+    std::vector<uint8_t> in_;
+};
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Lock-Free Queue
+// ============================================================================
+
+/**
+ * @brief Unbounded lock-free multi-producer single-consumer queue
+ * 
+ * Intrusive linked list after Dmitry Vyukov: push() is wait-free (one atomic
+ * exchange), pop() must only be called from a single consumer thread. A pop()
+ * concurrent with an unfinished push() may briefly report the queue as empty.
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(new Node)
+        , tail_(head_.load(std::memory_order_relaxed)) {
+    }
+    
+    ~MpscQueue() {
+        while (pop()) {
+        }
+        delete tail_;
+    }
+    
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    
+    /**
+     * @brief Append a value (any thread)
+     */
+    void push(T value) {
+        Node* node = new Node;
+        node->value.emplace(std::move(value));
+        Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Remove the oldest value (consumer thread only)
+     */
+    std::optional<T> pop() {
+        // tail_ is a consumed stub, its successor holds the oldest value
+        Node* next = tail_->next.load(std::memory_order_acquire);
+        if (!next) {
+            return std::nullopt;
+        }
+        std::optional<T> value = std::move(next->value);
+        next->value.reset();
+        delete tail_;
+        tail_ = next;
+        return value;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next = nullptr;
+        std::optional<T> value;
+    };
+    
+    std::atomic<Node*> head_;  // last pushed node, shared by producers
+    Node* tail_;               // consumer side
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "caparoc/registers.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Physical Values
+// ============================================================================
+
+/**
+ * @brief Convert a raw register value to its physical value (raw * scale + offset)
+ *
+ * INT16 registers are sign-extended. Registers without a unit have a scale of one
+ * and no offset, so their raw value is returned.
+ *
+ * @param info Register description
+ * @param raw Raw register value
+ * @return double Value in info.unit
+ */
+constexpr double to_physical(const RegisterInfo& info, uint16_t raw) {
+    const double value = info.type == RegisterType::INT16 ? static_cast<int16_t>(raw) : raw;
+    return value * info.scale + info.offset;
+}
+
+/**
+ * @brief Converts blocks of raw register values to physical values in one pass
+ *
+ * The scale, offset and signedness of every word of the block are looked up once in
+ * register_table when the decoder is built. decode() then runs a single branch-free
+ * loop over the block, which the compiler can vectorise. Words that do not start a
+ * single-word register (strings, halves of 32 bit values, unmapped addresses) are
+ * passed through unchanged by both outputs, without fixed_point_scale applied.
+ *
+ * Several samples of the same block can be decoded in one call by concatenating
+ * them, e.g. a day of load current readings for a historian.
+ *
+ * Fixed-point output holds the physical value multiplied by fixed_point_scale, so the
+ * default of 1000 yields mA, mV and m°C. It is exact for every register whose scale
+ * and offset are multiples of 1 / fixed_point_scale.
+ */
+class PhysicalDecoder {
+public:
+    /**
+     * @param address First register of the block
+     * @param count Number of registers in the block
+     * @param fixed_point_scale Resolution of the fixed-point output (units per physical unit)
+     * @throws std::invalid_argument if the block is empty or exceeds the address space, or a
+     *         register of the block cannot be represented exactly with fixed_point_scale
+     */
+    PhysicalDecoder(uint16_t address, uint16_t count, int32_t fixed_point_scale = 1000);
+
+    /**
+     * @brief Decoder for the block covering all members of a family (family_range())
+     */
+    explicit PhysicalDecoder(const RegisterFamily& family, int32_t fixed_point_scale = 1000);
+
+    uint16_t address() const { return address_; }
+    uint16_t count() const { return count_; }
+    int32_t fixed_point_scale() const { return fixed_point_scale_; }
+
+    /**
+     * @brief Convert samples of the block to floating-point physical values
+     *
+     * @param raw One or more consecutive samples of count() raw values
+     * @param out Physical values, same size as raw
+     * @throws std::invalid_argument if raw is not a whole number of samples or out differs in size
+     */
+    void decode(std::span<const uint16_t> raw, std::span<float> out) const;
+
+    /**
+     * @brief Convert samples of the block to fixed-point physical values
+     *
+     * @param raw One or more consecutive samples of count() raw values
+     * @param out Physical values times fixed_point_scale(), same size as raw
+     * @throws std::invalid_argument if raw is not a whole number of samples or out differs in size
+     */
+    void decode(std::span<const uint16_t> raw, std::span<int32_t> out) const;
+
+private:
+    void check_sizes(size_t raw_size, size_t out_size) const;
+
+    uint16_t address_;
+    uint16_t count_;
+    int32_t fixed_point_scale_;
+
+    // Per word of the block
+    std::vector<uint16_t> sign_;          // 0x8000 for INT16 registers, 0 otherwise
+    std::vector<float> scale_;
+    std::vector<float> offset_;
+    std::vector<int32_t> fixed_scale_;
+    std::vector<int32_t> fixed_offset_;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <functional>
+#include <stop_token>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/read_planner.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Multi-Rate Polling
+// ============================================================================
+
+/**
+ * @brief Typical refresh rates of register groups
+ */
+enum class RateClass {
+    status,       // 100 ms, e.g. global status byte
+    measurement,  // 500 ms, e.g. load currents
+    lifetime,     // 1 h, e.g. QUINT remaining lifetime (0x7005) and SOH (0x7006)
+    once          // read a single time, e.g. product information
+};
+
+/**
+ * @brief Polling period of a rate class (zero for RateClass::once)
+ */
+constexpr std::chrono::milliseconds rate_class_period(RateClass rate) {
+    switch (rate) {
+        case RateClass::status: return std::chrono::milliseconds(100);
+        case RateClass::measurement: return std::chrono::milliseconds(500);
+        case RateClass::lifetime: return std::chrono::hours(1);
+        case RateClass::once: return std::chrono::milliseconds(0);
+    }
+    return std::chrono::milliseconds(0);
+}
+
+/**
+ * @brief Polls register groups at individual rates with combined block reads
+ * 
+ * Groups that are due at the same time (within the merge window) are planned
+ * together, so their registers share block reads. Periods are never shorter than
+ * the device refresh: the CAPAROC bus cycle (0x6006) for CAPAROC registers and
+ * the QUINT bus cycle (0x6007) for QUINT registers (0x7000-0x70FF, 0xD000-0xD0FF).
+ * Not thread-safe, except that run() can be stopped from another thread.
+ */
+class PollScheduler {
+public:
+    using clock = std::chrono::steady_clock;
+    
+    /// Called with the values of the round the group took part in, which contain all registers of the group
+    using Handler = std::function<void(const RegisterValues& values)>;
+    
+    /// Called when registers of a group could not be read
+    using ErrorHandler = std::function<void(size_t group)>;
+    
+    /**
+     * @brief Add a register group
+     * 
+     * @param ranges Registers of the group
+     * @param period Polling period, zero to read the group once (retried after set_retry_delay() until it succeeds)
+     * @param handler Called with the values whenever the group was read
+     * @return size_t Group handle
+     */
+    size_t add_group(std::vector<ReadRequest> ranges, std::chrono::milliseconds period, Handler handler);
+    
+    /**
+     * @brief Add a register group polled at the period of a rate class
+     */
+    size_t add_group(std::vector<ReadRequest> ranges, RateClass rate, Handler handler);
+    
+    void remove_group(size_t group);
+    
+    void on_error(ErrorHandler handler);
+    
+    /**
+     * @brief Read the bus cycle times (0x6006-0x6007) used for pacing
+     * 
+     * @param conn MODBUS connection
+     * @return true if successful
+     */
+    bool update_bus_cycles(libmodbus_cpp::ModbusConnection& conn);
+    
+    /**
+     * @brief Set the bus cycle times used for pacing
+     */
+    void set_bus_cycles(std::chrono::milliseconds caparoc_bus_cycle, std::chrono::milliseconds quint_bus_cycle);
+    
+    /**
+     * @brief Groups due within this window are read together with the ones due now
+     */
+    void set_merge_window(std::chrono::milliseconds window) { merge_window_ = window; }
+    
+    /**
+     * @brief Options for planning the combined reads
+     */
+    void set_plan_options(const ReadPlanOptions& options) { plan_options_ = options; }
+    
+    /**
+     * @brief Wait before a failed one-shot group is read again (at least the bus cycle)
+     */
+    void set_retry_delay(std::chrono::milliseconds delay) { retry_delay_ = delay; }
+    
+    /**
+     * @brief Read all due groups with combined block reads and call their handlers
+     * 
+     * Handlers may add and remove groups, including their own.
+     * 
+     * @param conn MODBUS connection
+     * @param now Current time
+     * @return clock::time_point Time at which the next group is due (clock::time_point::max() if none)
+     */
+    clock::time_point run_due(libmodbus_cpp::ModbusConnection& conn, clock::time_point now = clock::now());
+    
+    /**
+     * @brief Time at which the next group is due
+     */
+    clock::time_point next_due() const;
+    
+    /**
+     * @brief Poll until a stop is requested
+     * 
+     * Bus cycle times are read once before the first round.
+     * 
+     * @param conn MODBUS connection
+     * @param stop Stop token
+     */
+    void run(libmodbus_cpp::ModbusConnection& conn, std::stop_token stop);
+
+private:
+    struct Group {
+        size_t handle;
+        std::vector<ReadRequest> ranges;
+        std::chrono::milliseconds period;
+        std::chrono::milliseconds effective_period;
+        bool quint;
+        clock::time_point next_due;
+        Handler handler;
+    };
+    
+    void update_effective_period(Group& group) const;
+    Group* find_group(size_t handle);
+    
+    std::vector<Group> groups_;
+    size_t next_handle_ = 0;
+    std::vector<ErrorHandler> error_handlers_;
+    std::chrono::milliseconds caparoc_bus_cycle_{0};
+    std::chrono::milliseconds quint_bus_cycle_{0};
+    std::chrono::milliseconds merge_window_{20};
+    std::chrono::milliseconds retry_delay_{1000};
+    ReadPlanOptions plan_options_;
+};
+
+} // namespace v1
+} // namespace caparoc
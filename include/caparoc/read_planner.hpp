@@ -0,0 +1,274 @@
+#pragma once
+
+#include <string>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/registers.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Read Planning
+// ============================================================================
+
+/**
+ * @brief One contiguous block of registers
+ */
+struct ReadRequest {
+    uint16_t address;
+    uint16_t count;
+};
+
+/**
+ * @brief Options controlling how requested registers are coalesced into block reads
+ */
+struct ReadPlanOptions {
+    /// Upper bound for the size of a single request (at most max_read_registers)
+    uint16_t max_registers_per_request = max_read_registers;
+
+    /// Largest number of unrequested registers read to join two requested ranges
+    uint16_t max_gap = 32;
+
+    /// Never read across addresses that are unmapped or write-only in register_table
+    bool skip_unmapped = true;
+};
+
+/**
+ * @brief Sequence of block reads covering a set of registers, sorted by address
+ */
+struct ReadPlan {
+    std::vector<ReadRequest> requests;
+
+    /**
+     * @brief Total number of registers transferred by the plan
+     */
+    size_t register_count() const;
+};
+
+/**
+ * @brief Check whether an address may be read (mapped in register_table and not write-only)
+ *
+ * @param address Register address
+ */
+bool is_readable_register(uint16_t address);
+
+/**
+ * @brief Plan block reads for a set of register ranges
+ *
+ * Ranges may be unsorted and overlapping. They are split at request boundaries
+ * where necessary.
+ *
+ * @param ranges Ranges to read
+ * @param options Coalescing options
+ * @return ReadPlan Minimal set of contiguous requests covering all ranges
+ */
+ReadPlan plan_reads(std::span<const ReadRequest> ranges, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Plan block reads for a set of single register addresses
+ *
+ * @param addresses Addresses to read (unsorted, duplicates allowed)
+ * @param options Coalescing options
+ * @return ReadPlan Minimal set of contiguous requests covering all addresses
+ */
+ReadPlan plan_reads(std::span<const uint16_t> addresses, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Plan block reads for a set of registers from register_table
+ *
+ * Multi-register values (UINT32, STRING32) are never split across requests.
+ *
+ * @param registers Registers to read
+ * @param options Coalescing options
+ * @return ReadPlan Minimal set of contiguous requests covering all registers
+ */
+ReadPlan plan_reads(std::span<const RegisterInfo> registers, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Raw register values keyed by address
+ */
+class RegisterValues {
+public:
+    /**
+     * @brief Store a block of consecutive values, replacing previously stored ones
+     *
+     * @param address Address of values[0]
+     * @param values Register values
+     */
+    void assign(uint16_t address, std::span<const uint16_t> values);
+
+    /**
+     * @brief Check whether all registers of a range are present
+     */
+    bool contains(uint16_t address, uint16_t count = 1) const;
+
+    /**
+     * @brief Get a single register value
+     */
+    std::optional<uint16_t> get(uint16_t address) const;
+
+    /**
+     * @brief Get a range of consecutive register values
+     *
+     * @return std::span<const uint16_t> Values, empty if any register of the range is missing
+     */
+    std::span<const uint16_t> get(uint16_t address, uint16_t count) const;
+
+    size_t size() const { return addresses_.size(); }
+    bool empty() const { return addresses_.empty(); }
+    void clear();
+
+private:
+    // Parallel arrays sorted by address, so consecutive addresses are adjacent
+    std::vector<uint16_t> addresses_;
+    std::vector<uint16_t> values_;
+};
+
+/**
+ * @brief Decoded value of a register according to its RegisterType
+ */
+using RegisterValue = std::variant<uint16_t, int16_t, uint32_t, int32_t, float, std::string>;
+
+/**
+ * @brief Decode a register from raw values
+ *
+ * @param info Register description
+ * @param values Raw values containing all words of the register
+ * @return std::optional<RegisterValue> Decoded value, std::nullopt if words are missing
+ */
+std::optional<RegisterValue> decode_register(const RegisterInfo& info, const RegisterValues& values);
+
+/**
+ * @brief Decode a register described by a Register<> type from raw values
+ *
+ * @param values Raw values containing all words of the register
+ * @return std::optional<typename Reg::value_type> Decoded value, std::nullopt if words are missing
+ */
+template <ReadableRegister Reg>
+std::optional<typename Reg::value_type> decode_register(const RegisterValues& values) {
+    auto words = values.get(Reg::address, Reg::num_registers);
+    if (words.empty()) {
+        return std::nullopt;
+    }
+    return decode<Reg>(words.template first<Reg::num_registers>());
+}
+
+/**
+ * @brief Execute all requests of a plan
+ *
+ * @param conn MODBUS connection
+ * @param plan Plan to execute
+ * @return std::optional<RegisterValues> Values of all read registers, std::nullopt if any request failed
+ */
+std::optional<RegisterValues> execute_read_plan(libmodbus_cpp::ModbusConnection& conn, const ReadPlan& plan);
+
+/**
+ * @brief Execute the requests of a plan within a time budget
+ *
+ * Requests are issued in plan order until the deadline has passed, a stop is
+ * requested or a request fails. The remaining requests are skipped.
+ *
+ * @param conn MODBUS connection
+ * @param plan Plan to execute
+ * @param deadline Budget for all requests
+ * @param stop Cancels the remaining requests
+ * @return RegisterValues Values of the requests that completed, check with contains()
+ */
+RegisterValues execute_read_plan(libmodbus_cpp::ModbusConnection& conn, const ReadPlan& plan, Deadline deadline, std::stop_token stop = {});
+
+/**
+ * @brief Plan and execute reads for a set of addresses
+ *
+ * @param conn MODBUS connection
+ * @param addresses Addresses to read
+ * @param options Coalescing options
+ * @return std::optional<RegisterValues> Raw values keyed by address if all reads succeeded
+ */
+std::optional<RegisterValues> read_planned(libmodbus_cpp::ModbusConnection& conn, std::span<const uint16_t> addresses, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Plan and execute reads for a set of registers and decode them
+ *
+ * @param conn MODBUS connection
+ * @param registers Registers to read, e.g. entries of register_table
+ * @param options Coalescing options
+ * @return std::optional<std::map<uint16_t, RegisterValue>> Decoded values keyed by address if all reads succeeded
+ */
+std::optional<std::map<uint16_t, RegisterValue>> read_planned(libmodbus_cpp::ModbusConnection& conn, std::span<const RegisterInfo> registers, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Plan used by read_status_snapshot() for the status block (0x6000-0x60CF)
+ */
+const ReadPlan& status_snapshot_read_plan();
+
+// ============================================================================
+// Register Families
+// ============================================================================
+
+/**
+ * @brief Block covering all members of a family
+ */
+constexpr ReadRequest family_range(const RegisterFamily& family) {
+    return {family.base, family.span()};
+}
+
+/**
+ * @brief Block covering the members of one module of a family
+ *
+ * @param family Register family
+ * @param module_number Module number (1-based)
+ */
+constexpr ReadRequest family_module_range(const RegisterFamily& family, uint8_t module_number) {
+    return {family.address(module_number), family.module_span()};
+}
+
+/**
+ * @brief Find a family by its name, e.g. "load_current"
+ *
+ * @return const RegisterFamily* Family, nullptr if no family has that name
+ */
+constexpr const RegisterFamily* find_register_family(std::string_view name) {
+    for (const auto* family : register_family_table) {
+        if (family->name == name) {
+            return family;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Read all members of a family
+ *
+ * Multi-register members (STRING32, UINT32) are never split across requests.
+ *
+ * @param conn MODBUS connection
+ * @param family Register family
+ * @param options Coalescing options
+ * @return std::optional<RegisterValues> Raw values keyed by address if all reads succeeded
+ * @throws std::invalid_argument if the family is write-only
+ */
+std::optional<RegisterValues> read_family(libmodbus_cpp::ModbusConnection& conn, const RegisterFamily& family, const ReadPlanOptions& options = {});
+
+/**
+ * @brief Read the members of one module of a family
+ *
+ * @param conn MODBUS connection
+ * @param family Register family
+ * @param module_number Module number (1-based)
+ * @param options Coalescing options
+ * @return std::optional<RegisterValues> Raw values keyed by address if all reads succeeded
+ * @throws std::invalid_argument if the family is write-only or the module number is out of range
+ */
+std::optional<RegisterValues> read_family_module(libmodbus_cpp::ModbusConnection& conn, const RegisterFamily& family, uint8_t module_number, const ReadPlanOptions& options = {});
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include "caparoc/caparoc.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Register Value Cache
+// ============================================================================
+
+/**
+ * @brief Groups of registers sharing a cache lifetime
+ */
+enum class RegisterClass {
+    control,         // 0x0000-0x0FFF, write-only resets, never cached
+    identification,  // 0x1000-0x1FFF, product strings
+    topology,        // 0x2000-0x2FFF, module and channel counts
+    status,          // 0x6000-0x6FFF, status, measurements and counters
+    quint,           // 0x7000-0x7FFF, QUINT measurements
+    configuration,   // 0xC000-0xDFFF, CAPAROC and QUINT settings
+    other
+};
+
+/// Number of RegisterClass values
+constexpr size_t register_class_count = static_cast<size_t>(RegisterClass::other) + 1;
+
+/**
+ * @brief Register class of an address
+ */
+constexpr RegisterClass classify_register(uint16_t address) {
+    switch (address >> 12) {
+        case 0x0: return RegisterClass::control;
+        case 0x1: return RegisterClass::identification;
+        case 0x2: return RegisterClass::topology;
+        case 0x6: return RegisterClass::status;
+        case 0x7: return RegisterClass::quint;
+        case 0xC:
+        case 0xD: return RegisterClass::configuration;
+        default: return RegisterClass::other;
+    }
+}
+
+/**
+ * @brief Raw register values with acquisition timestamps
+ * 
+ * Used explicitly through a CachedConnection: its accessors (read_registers(),
+ * read_uint16(), get_input_voltage(), read_status_snapshot(), ...) are answered from the
+ * cache if all requested registers are younger than the TTL of their class, and every
+ * read from the device stores its values. Thread-safe.
+ */
+class RegisterCache {
+public:
+    using clock = std::chrono::steady_clock;
+    
+    /**
+     * @brief Cache with default TTLs
+     * 
+     * identification 1 h, topology 10 s, status 100 ms, quint 1 s, configuration 1 s;
+     * control and other registers are not cached.
+     */
+    RegisterCache();
+    
+    /**
+     * @brief Set the lifetime of a class, zero disables caching for it
+     */
+    void set_ttl(RegisterClass register_class, clock::duration ttl);
+    
+    clock::duration ttl(RegisterClass register_class) const;
+    
+    /**
+     * @brief Fetch fresh values for a range
+     * 
+     * @param address First register
+     * @param values Destination, its size is the number of registers
+     * @param now Current time
+     * @return true if all registers were present and fresh
+     */
+    bool lookup(uint16_t address, std::span<uint16_t> values, clock::time_point now = clock::now());
+    
+    /**
+     * @brief Store values acquired at the given time
+     */
+    void store(uint16_t address, std::span<const uint16_t> values, clock::time_point acquired = clock::now());
+    
+    /**
+     * @brief Forget a range of registers
+     */
+    void invalidate(uint16_t address, uint16_t count = 1);
+    
+    /**
+     * @brief Forget all registers of a class
+     */
+    void invalidate(RegisterClass register_class);
+    
+    void clear();
+    
+    uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry {
+        uint16_t value;
+        clock::time_point acquired;
+    };
+    
+    mutable std::mutex mutex_;
+    std::array<clock::duration, register_class_count> ttl_;
+    std::unordered_map<uint16_t, Entry> entries_;
+    std::atomic<uint64_t> hits_ = 0;
+    std::atomic<uint64_t> misses_ = 0;
+};
+
+/**
+ * @brief A connection paired with the cache its reads should use
+ * 
+ * Only the overloads taking a CachedConnection consult the cache; every other
+ * function of the library reads from the device. Both objects must outlive the
+ * CachedConnection. Writes made without it are not seen by the cache, so values it
+ * holds may be stale for up to the TTL of their class.
+ */
+class CachedConnection {
+public:
+    /**
+     * @param conn MODBUS connection
+     * @param cache Cache, may be shared by several connections to the same device
+     */
+    CachedConnection(libmodbus_cpp::ModbusConnection& conn, RegisterCache& cache)
+        : conn_(&conn)
+        , cache_(&cache) {
+    }
+    
+    libmodbus_cpp::ModbusConnection& connection() const { return *conn_; }
+    RegisterCache& cache() const { return *cache_; }
+
+private:
+    libmodbus_cpp::ModbusConnection* conn_;
+    RegisterCache* cache_;
+};
+
+// ============================================================================
+// Cached Accessors
+// ============================================================================
+
+/**
+ * @brief Read a block of registers, answered from the cache if all values are fresh
+ * 
+ * Values read from the device are stored in the cache.
+ * 
+ * @param conn Connection and cache
+ * @param address Starting register address
+ * @param values Destination, its size is the number of registers to read (1-125)
+ * @return true if successful
+ */
+bool read_registers(CachedConnection& conn, uint16_t address, std::span<uint16_t> values);
+
+/**
+ * @brief Write a block of registers and invalidate them in the cache
+ * 
+ * Writes to control registers (error resets) invalidate the whole status class.
+ * 
+ * @param conn Connection and cache
+ * @param address Starting register address
+ * @param values Values to write (1-123 registers)
+ * @return true if successful
+ */
+bool write_registers(CachedConnection& conn, uint16_t address, std::span<const uint16_t> values);
+
+std::optional<uint16_t> read_uint16(CachedConnection& conn, uint16_t address);
+std::optional<uint32_t> read_uint32(CachedConnection& conn, uint16_t address);
+std::optional<std::string> read_string32(CachedConnection& conn, uint16_t address);
+bool write_uint16(CachedConnection& conn, uint16_t address, uint16_t value);
+
+/**
+ * @brief Read a register described by a Register<> type through the cache
+ */
+template <ReadableRegister Reg>
+std::optional<typename Reg::value_type> read(CachedConnection& conn) {
+    std::array<uint16_t, Reg::num_registers> words{};
+    if (!read_registers(conn, Reg::address, words)) {
+        return std::nullopt;
+    }
+    return decode<Reg>(std::span<const uint16_t, Reg::num_registers>(words));
+}
+
+/**
+ * @brief Write a register described by a Register<> type and invalidate it in the cache
+ */
+template <WritableRegister Reg>
+bool write(CachedConnection& conn, typename Reg::value_type value) {
+    const auto words = encode<Reg>(value);
+    return write_registers(conn, Reg::address, words);
+}
+
+std::optional<std::string> get_product_name_power_module(CachedConnection& conn);
+std::optional<std::string> get_product_name_quint(CachedConnection& conn);
+std::optional<GlobalStatus> get_global_status(CachedConnection& conn);
+std::optional<uint16_t> get_total_system_current(CachedConnection& conn);
+std::optional<uint16_t> get_input_voltage(CachedConnection& conn);
+std::optional<uint16_t> get_sum_of_nominal_currents(CachedConnection& conn);
+std::optional<int16_t> get_internal_temperature(CachedConnection& conn);
+
+/**
+ * @brief Module and channel accessors through the cache
+ * 
+ * The module and channel numbers are validated against topology, which is refreshed
+ * from the device (never from the cache) if it is not valid.
+ * 
+ * @throws std::invalid_argument if the module or channel does not exist
+ */
+std::optional<std::string> get_product_name_module(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number);
+std::optional<uint16_t> get_nominal_current(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+std::optional<ChannelStatus> get_channel_status(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+std::optional<uint16_t> get_load_current(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number);
+
+/**
+ * @brief Read the complete status block, each planned request answered from the cache if fresh
+ */
+std::optional<StatusSnapshot> read_status_snapshot(CachedConnection& conn);
+
+} // namespace v1
+} // namespace caparoc
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <string>
 
 namespace caparoc {
 inline namespace v1 {
@@ -30,6 +32,53 @@ struct RegisterInfo {
     RegisterAccess access;
     const char* name;
     const char* description;
+    float scale = 1.0f;    // physical value = raw value * scale + offset
+    float offset = 0.0f;
+    const char* unit = "";  // unit of the physical value, empty for counts, bit fields and strings
+};
+
+// Number of registers occupied by a value of type T
+template <typename T>
+constexpr uint16_t register_words = sizeof(T) / sizeof(uint16_t);
+
+template <>
+inline constexpr uint16_t register_words<std::string> = 16;
+
+// Register whose address, value type and access mode are known at compile time
+template <uint16_t Address, typename T, RegisterAccess Access>
+struct Register {
+    using value_type = T;
+    static constexpr uint16_t address = Address;
+    static constexpr uint16_t num_registers = register_words<T>;
+    static constexpr RegisterAccess access = Access;
+};
+
+// Registers that repeat per module (and channel) with constant strides
+struct RegisterFamily {
+    const char* name;
+    uint16_t base;            // address for module 1, channel 1
+    uint16_t module_stride;   // address distance between modules
+    uint16_t channel_stride;  // address distance between channels, 0 for per-module families
+    uint8_t modules;
+    uint8_t channels;         // 1 for per-module families
+    uint16_t num_registers;   // registers per member
+    RegisterType type;
+    RegisterAccess access;
+
+    // Address of the member for a module (1-based) and channel (1-based)
+    constexpr uint16_t address(uint8_t module_number, uint8_t channel_number = 1) const {
+        return static_cast<uint16_t>(base + (module_number - 1) * module_stride + (channel_number - 1) * channel_stride);
+    }
+
+    // Number of registers from the first member to the end of the last member of a module
+    constexpr uint16_t module_span() const {
+        return static_cast<uint16_t>((channels - 1) * channel_stride + num_registers);
+    }
+
+    // Number of registers from the first member to the end of the last member
+    constexpr uint16_t span() const {
+        return static_cast<uint16_t>((modules - 1) * module_stride + module_span());
+    }
 };
 
 namespace registers {
@@ -821,6 +870,827 @@ constexpr uint16_t THRESHOLD_VALUE_FOR_REMAINING_LIFETIME_QUINT_POWER_SUPPLY = 0
 
 } // namespace registers
 
+// Typed register descriptors, named like the address constants in namespace registers
+namespace regs {
+
+using RESETTING_THE_APPLICATION_PARAMETERS_TO_DEFAULT_SETTINGS_POW = Register<0x0010, uint16_t, RegisterAccess::WRITE_ONLY>;
+using GLOBAL_CHANNEL_ERROR_RESET_ALL_CIRCUIT_BREAKER_MODULES = Register<0x0011, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_ALL_CIRCUIT_BREAKER_MODULES = Register<0x0012, uint16_t, RegisterAccess::WRITE_ONLY>;
+using RESETTING_THE_APPLICATION_PARAMETERS_TO_DEFAULT_SETTINGS_QUI = Register<0x0020, uint16_t, RegisterAccess::WRITE_ONLY>;
+using RESET_STATISTICS_QUINT_POWER_SUPPLY = Register<0x0021, uint16_t, RegisterAccess::WRITE_ONLY>;
+using RESETTING_THE_APPLICATION_PARAMETERS_TO_DEFAULT_SETTINGS_MOD = Register<0x0100, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0101 = Register<0x0101, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0102 = Register<0x0102, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0103 = Register<0x0103, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0104 = Register<0x0104, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0105 = Register<0x0105, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0106 = Register<0x0106, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0107 = Register<0x0107, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0108 = Register<0x0108, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_0109 = Register<0x0109, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010A = Register<0x010A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010B = Register<0x010B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010C = Register<0x010C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010D = Register<0x010D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010E = Register<0x010E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using REG_010F = Register<0x010F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_1_ALL_CHANNELS = Register<0x0110, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_2_ALL_CHANNELS = Register<0x0111, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_3_ALL_CHANNELS = Register<0x0112, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_4_ALL_CHANNELS = Register<0x0113, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_5_ALL_CHANNELS = Register<0x0114, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_6_ALL_CHANNELS = Register<0x0115, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_7_ALL_CHANNELS = Register<0x0116, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_8_ALL_CHANNELS = Register<0x0117, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_9_ALL_CHANNELS = Register<0x0118, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_10_ALL_CHANNELS = Register<0x0119, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_11_ALL_CHANNELS = Register<0x011A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_12_ALL_CHANNELS = Register<0x011B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_13_ALL_CHANNELS = Register<0x011C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_14_ALL_CHANNELS = Register<0x011D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_15_ALL_CHANNELS = Register<0x011E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using CHANNEL_ERROR_RESET_MODULE_16_ALL_CHANNELS = Register<0x011F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_1_CHANNEL_1 = Register<0x0120, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_1_CHANNEL_2 = Register<0x0121, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_1_CHANNEL_3 = Register<0x0122, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_1_CHANNEL_4 = Register<0x0123, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_2_CHANNEL_1 = Register<0x0124, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_2_CHANNEL_2 = Register<0x0125, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_2_CHANNEL_3 = Register<0x0126, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_2_CHANNEL_4 = Register<0x0127, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_3_CHANNEL_1 = Register<0x0128, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_3_CHANNEL_2 = Register<0x0129, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_3_CHANNEL_3 = Register<0x012A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_3_CHANNEL_4 = Register<0x012B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_4_CHANNEL_1 = Register<0x012C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_4_CHANNEL_2 = Register<0x012D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_4_CHANNEL_3 = Register<0x012E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_4_CHANNEL_4 = Register<0x012F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_5_CHANNEL_1 = Register<0x0130, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_5_CHANNEL_2 = Register<0x0131, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_5_CHANNEL_3 = Register<0x0132, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_5_CHANNEL_4 = Register<0x0133, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_6_CHANNEL_1 = Register<0x0134, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_6_CHANNEL_2 = Register<0x0135, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_6_CHANNEL_3 = Register<0x0136, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_6_CHANNEL_4 = Register<0x0137, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_7_CHANNEL_1 = Register<0x0138, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_7_CHANNEL_2 = Register<0x0139, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_7_CHANNEL_3 = Register<0x013A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_7_CHANNEL_4 = Register<0x013B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_8_CHANNEL_1 = Register<0x013C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_8_CHANNEL_2 = Register<0x013D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_8_CHANNEL_3 = Register<0x013E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_8_CHANNEL_4 = Register<0x013F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_9_CHANNEL_1 = Register<0x0140, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_9_CHANNEL_2 = Register<0x0141, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_9_CHANNEL_3 = Register<0x0142, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_9_CHANNEL_4 = Register<0x0143, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_10_CHANNEL_1 = Register<0x0144, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_10_CHANNEL_2 = Register<0x0145, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_10_CHANNEL_3 = Register<0x0146, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_10_CHANNEL_4 = Register<0x0147, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_11_CHANNEL_1 = Register<0x0148, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_11_CHANNEL_2 = Register<0x0149, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_11_CHANNEL_3 = Register<0x014A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_11_CHANNEL_4 = Register<0x014B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_12_CHANNEL_1 = Register<0x014C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_12_CHANNEL_2 = Register<0x014D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_12_CHANNEL_3 = Register<0x014E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_12_CHANNEL_4 = Register<0x014F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_13_CHANNEL_1 = Register<0x0150, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_13_CHANNEL_2 = Register<0x0151, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_13_CHANNEL_3 = Register<0x0152, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_13_CHANNEL_4 = Register<0x0153, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_14_CHANNEL_1 = Register<0x0154, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_14_CHANNEL_2 = Register<0x0155, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_14_CHANNEL_3 = Register<0x0156, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_14_CHANNEL_4 = Register<0x0157, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_15_CHANNEL_1 = Register<0x0158, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_15_CHANNEL_2 = Register<0x0159, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_15_CHANNEL_3 = Register<0x015A, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_15_CHANNEL_4 = Register<0x015B, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_16_CHANNEL_1 = Register<0x015C, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_16_CHANNEL_2 = Register<0x015D, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_16_CHANNEL_3 = Register<0x015E, uint16_t, RegisterAccess::WRITE_ONLY>;
+using ERROR_COUNTER_RESET_MODULE_16_CHANNEL_4 = Register<0x015F, uint16_t, RegisterAccess::WRITE_ONLY>;
+using PRODUCT_NAME_POWER_MODULE = Register<0x1000, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_1 = Register<0x1010, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_2 = Register<0x1020, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_3 = Register<0x1030, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_4 = Register<0x1040, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_5 = Register<0x1050, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_6 = Register<0x1060, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_7 = Register<0x1070, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_8 = Register<0x1080, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_9 = Register<0x1090, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_10 = Register<0x10A0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_11 = Register<0x10B0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_12 = Register<0x10C0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_13 = Register<0x10D0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_14 = Register<0x10E0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_15 = Register<0x10F0, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_MODULE_16 = Register<0x1100, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_NAME_QUINT_POWER_SUPPLY = Register<0x1110, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_ID_POWER_MODULE = Register<0x1200, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_1 = Register<0x1210, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_2 = Register<0x1220, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_3 = Register<0x1230, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_4 = Register<0x1240, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_5 = Register<0x1250, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_6 = Register<0x1260, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_7 = Register<0x1270, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_8 = Register<0x1280, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_9 = Register<0x1290, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_10 = Register<0x12A0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_11 = Register<0x12B0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_12 = Register<0x12C0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_13 = Register<0x12D0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_14 = Register<0x12E0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_15 = Register<0x12F0, std::string, RegisterAccess::READ_ONLY>;
+using MODULE_ORDER_NO_MODULE_16 = Register<0x1300, std::string, RegisterAccess::READ_ONLY>;
+using PRODUCT_ID_QUINT_POWER_SUPPLY = Register<0x1310, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_POWER_MODULE = Register<0x1400, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_1 = Register<0x1410, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_2 = Register<0x1420, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_3 = Register<0x1430, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_4 = Register<0x1440, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_5 = Register<0x1450, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_6 = Register<0x1460, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_7 = Register<0x1470, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_8 = Register<0x1480, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_9 = Register<0x1490, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_10 = Register<0x14A0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_11 = Register<0x14B0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_12 = Register<0x14C0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_13 = Register<0x14D0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_14 = Register<0x14E0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_15 = Register<0x14F0, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_MODULE_16 = Register<0x1500, std::string, RegisterAccess::READ_ONLY>;
+using SERIAL_NUMBER_QUINT_POWER_SUPPLY = Register<0x1510, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_POWER_MODULE = Register<0x1600, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_1 = Register<0x1610, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_2 = Register<0x1620, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_3 = Register<0x1630, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_4 = Register<0x1640, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_5 = Register<0x1650, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_6 = Register<0x1660, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_7 = Register<0x1670, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_8 = Register<0x1680, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_9 = Register<0x1690, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_10 = Register<0x16A0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_11 = Register<0x16B0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_12 = Register<0x16C0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_13 = Register<0x16D0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_14 = Register<0x16E0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_15 = Register<0x16F0, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_MODULE_16 = Register<0x1700, std::string, RegisterAccess::READ_ONLY>;
+using HARDWARE_VERSION_QUINT_POWER_SUPPLY = Register<0x1710, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_REVISION_POWER_MODULE = Register<0x1800, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_1 = Register<0x1810, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_2 = Register<0x1820, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_3 = Register<0x1830, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_4 = Register<0x1840, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_5 = Register<0x1850, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_6 = Register<0x1860, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_7 = Register<0x1870, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_8 = Register<0x1880, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_9 = Register<0x1890, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_10 = Register<0x18A0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_11 = Register<0x18B0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_12 = Register<0x18C0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_13 = Register<0x18D0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_14 = Register<0x18E0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_15 = Register<0x18F0, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_MODULE_16 = Register<0x1900, std::string, RegisterAccess::READ_ONLY>;
+using FIRMWARE_VERSION_QUINT_POWER_SUPPLY = Register<0x1910, std::string, RegisterAccess::READ_ONLY>;
+using NO_OF_CURRENTLY_CONNECTED_MODULES = Register<0x2000, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_1 = Register<0x2001, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_2 = Register<0x2002, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_3 = Register<0x2003, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_4 = Register<0x2004, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_5 = Register<0x2005, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_6 = Register<0x2006, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_7 = Register<0x2007, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_8 = Register<0x2008, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_9 = Register<0x2009, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_10 = Register<0x200A, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_11 = Register<0x200B, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_12 = Register<0x200C, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_13 = Register<0x200D, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_14 = Register<0x200E, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_15 = Register<0x200F, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CHANNELS_MODULE_16 = Register<0x2010, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_1 = Register<0x2020, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_2 = Register<0x2021, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_3 = Register<0x2022, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_4 = Register<0x2023, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_1 = Register<0x2024, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_2 = Register<0x2025, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_3 = Register<0x2026, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_4 = Register<0x2027, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_1 = Register<0x2028, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_2 = Register<0x2029, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_3 = Register<0x202A, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_4 = Register<0x202B, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_1 = Register<0x202C, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_2 = Register<0x202D, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_3 = Register<0x202E, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_4 = Register<0x202F, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_1 = Register<0x2030, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_2 = Register<0x2031, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_3 = Register<0x2032, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_4 = Register<0x2033, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_1 = Register<0x2034, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_2 = Register<0x2035, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_3 = Register<0x2036, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_4 = Register<0x2037, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_1 = Register<0x2038, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_2 = Register<0x2039, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_3 = Register<0x203A, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_4 = Register<0x203B, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_1 = Register<0x203C, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_2 = Register<0x203D, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_3 = Register<0x203E, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_4 = Register<0x203F, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_1 = Register<0x2040, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_2 = Register<0x2041, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_3 = Register<0x2042, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_4 = Register<0x2043, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_1 = Register<0x2044, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_2 = Register<0x2045, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_3 = Register<0x2046, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_4 = Register<0x2047, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_1 = Register<0x2048, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_2 = Register<0x2049, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_3 = Register<0x204A, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_4 = Register<0x204B, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_1 = Register<0x204C, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_2 = Register<0x204D, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_3 = Register<0x204E, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_4 = Register<0x204F, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_1 = Register<0x2050, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_2 = Register<0x2051, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_3 = Register<0x2052, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_4 = Register<0x2053, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_1 = Register<0x2054, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_2 = Register<0x2055, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_3 = Register<0x2056, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_4 = Register<0x2057, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_1 = Register<0x2058, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_2 = Register<0x2059, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_3 = Register<0x205A, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_4 = Register<0x205B, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_1 = Register<0x205C, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_2 = Register<0x205D, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_3 = Register<0x205E, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_4 = Register<0x205F, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_1 = Register<0x2060, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_2 = Register<0x2061, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_3 = Register<0x2062, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_1_CHANNEL_4 = Register<0x2063, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_1 = Register<0x2064, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_2 = Register<0x2065, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_3 = Register<0x2066, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_2_CHANNEL_4 = Register<0x2067, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_1 = Register<0x2068, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_2 = Register<0x2069, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_3 = Register<0x206A, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_3_CHANNEL_4 = Register<0x206B, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_1 = Register<0x206C, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_2 = Register<0x206D, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_3 = Register<0x206E, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_4_CHANNEL_4 = Register<0x206F, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_1 = Register<0x2070, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_2 = Register<0x2071, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_3 = Register<0x2072, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_5_CHANNEL_4 = Register<0x2073, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_1 = Register<0x2074, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_2 = Register<0x2075, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_3 = Register<0x2076, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_6_CHANNEL_4 = Register<0x2077, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_1 = Register<0x2078, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_2 = Register<0x2079, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_3 = Register<0x207A, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_7_CHANNEL_4 = Register<0x207B, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_1 = Register<0x207C, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_2 = Register<0x207D, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_3 = Register<0x207E, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_8_CHANNEL_4 = Register<0x207F, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_1 = Register<0x2080, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_2 = Register<0x2081, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_3 = Register<0x2082, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_9_CHANNEL_4 = Register<0x2083, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_1 = Register<0x2084, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_2 = Register<0x2085, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_3 = Register<0x2086, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_10_CHANNEL_4 = Register<0x2087, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_1 = Register<0x2088, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_2 = Register<0x2089, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_3 = Register<0x208A, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_11_CHANNEL_4 = Register<0x208B, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_1 = Register<0x208C, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_2 = Register<0x208D, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_3 = Register<0x208E, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_12_CHANNEL_4 = Register<0x208F, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_1 = Register<0x2090, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_2 = Register<0x2091, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_3 = Register<0x2092, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_13_CHANNEL_4 = Register<0x2093, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_1 = Register<0x2094, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_2 = Register<0x2095, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_3 = Register<0x2096, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_14_CHANNEL_4 = Register<0x2097, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_1 = Register<0x2098, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_2 = Register<0x2099, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_3 = Register<0x209A, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_15_CHANNEL_4 = Register<0x209B, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_1 = Register<0x209C, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_2 = Register<0x209D, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_3 = Register<0x209E, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMAL_NOMINAL_CURRENT_MODULE_16_CHANNEL_4 = Register<0x209F, uint16_t, RegisterAccess::READ_ONLY>;
+using GLOBAL_STATUS_BYTE = Register<0x6000, uint16_t, RegisterAccess::READ_ONLY>;
+using TOTAL_SYSTEM_CURRENT = Register<0x6001, uint16_t, RegisterAccess::READ_ONLY>;
+using INPUT_VOLTAGE = Register<0x6002, uint16_t, RegisterAccess::READ_ONLY>;
+using REG_6003 = Register<0x6003, uint16_t, RegisterAccess::READ_ONLY>;
+using NO_OF_CONNECTED_MODULES_AT_BOOT = Register<0x6004, uint16_t, RegisterAccess::READ_ONLY>;
+using SUM_OF_NOMINAL_CURRENTS = Register<0x6005, uint16_t, RegisterAccess::READ_ONLY>;
+using MAX_CAPAROC_BUS_CYCLE_MS = Register<0x6006, uint16_t, RegisterAccess::READ_ONLY>;
+using MAX_QUINT_POWER_BUS_CYCLE_MS = Register<0x6007, uint16_t, RegisterAccess::READ_ONLY>;
+using HOURS_SINCE_LAST_BOOT = Register<0x6008, uint16_t, RegisterAccess::READ_ONLY>;
+using INTERNAL_TEMPERATURE = Register<0x6009, int16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_1_CHANNEL_1 = Register<0x6010, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_1_CHANNEL_2 = Register<0x6011, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_1_CHANNEL_3 = Register<0x6012, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_1_CHANNEL_4 = Register<0x6013, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_2_CHANNEL_1 = Register<0x6014, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_2_CHANNEL_2 = Register<0x6015, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_2_CHANNEL_3 = Register<0x6016, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_2_CHANNEL_4 = Register<0x6017, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_3_CHANNEL_1 = Register<0x6018, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_3_CHANNEL_2 = Register<0x6019, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_3_CHANNEL_3 = Register<0x601A, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_3_CHANNEL_4 = Register<0x601B, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_4_CHANNEL_1 = Register<0x601C, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_4_CHANNEL_2 = Register<0x601D, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_4_CHANNEL_3 = Register<0x601E, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_4_CHANNEL_4 = Register<0x601F, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_5_CHANNEL_1 = Register<0x6020, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_5_CHANNEL_2 = Register<0x6021, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_5_CHANNEL_3 = Register<0x6022, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_5_CHANNEL_4 = Register<0x6023, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_6_CHANNEL_1 = Register<0x6024, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_6_CHANNEL_2 = Register<0x6025, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_6_CHANNEL_3 = Register<0x6026, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_6_CHANNEL_4 = Register<0x6027, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_7_CHANNEL_1 = Register<0x6028, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_7_CHANNEL_2 = Register<0x6029, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_7_CHANNEL_3 = Register<0x602A, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_7_CHANNEL_4 = Register<0x602B, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_8_CHANNEL_1 = Register<0x602C, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_8_CHANNEL_2 = Register<0x602D, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_8_CHANNEL_3 = Register<0x602E, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_8_CHANNEL_4 = Register<0x602F, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_9_CHANNEL_1 = Register<0x6030, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_9_CHANNEL_2 = Register<0x6031, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_9_CHANNEL_3 = Register<0x6032, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_9_CHANNEL_4 = Register<0x6033, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_10_CHANNEL_1 = Register<0x6034, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_10_CHANNEL_2 = Register<0x6035, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_10_CHANNEL_3 = Register<0x6036, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_10_CHANNEL_4 = Register<0x6037, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_11_CHANNEL_1 = Register<0x6038, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_11_CHANNEL_2 = Register<0x6039, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_11_CHANNEL_3 = Register<0x603A, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_11_CHANNEL_4 = Register<0x603B, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_12_CHANNEL_1 = Register<0x603C, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_12_CHANNEL_2 = Register<0x603D, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_12_CHANNEL_3 = Register<0x603E, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_12_CHANNEL_4 = Register<0x603F, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_13_CHANNEL_1 = Register<0x6040, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_13_CHANNEL_2 = Register<0x6041, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_13_CHANNEL_3 = Register<0x6042, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_13_CHANNEL_4 = Register<0x6043, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_14_CHANNEL_1 = Register<0x6044, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_14_CHANNEL_2 = Register<0x6045, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_14_CHANNEL_3 = Register<0x6046, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_14_CHANNEL_4 = Register<0x6047, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_15_CHANNEL_1 = Register<0x6048, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_15_CHANNEL_2 = Register<0x6049, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_15_CHANNEL_3 = Register<0x604A, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_15_CHANNEL_4 = Register<0x604B, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_16_CHANNEL_1 = Register<0x604C, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_16_CHANNEL_2 = Register<0x604D, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_16_CHANNEL_3 = Register<0x604E, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_MODULE_16_CHANNEL_4 = Register<0x604F, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_1_CHANNEL_1 = Register<0x6050, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_1_CHANNEL_2 = Register<0x6051, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_1_CHANNEL_3 = Register<0x6052, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_1_CHANNEL_4 = Register<0x6053, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_2_CHANNEL_1 = Register<0x6054, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_2_CHANNEL_2 = Register<0x6055, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_2_CHANNEL_3 = Register<0x6056, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_2_CHANNEL_4 = Register<0x6057, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_3_CHANNEL_1 = Register<0x6058, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_3_CHANNEL_2 = Register<0x6059, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_3_CHANNEL_3 = Register<0x605A, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_3_CHANNEL_4 = Register<0x605B, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_4_CHANNEL_1 = Register<0x605C, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_4_CHANNEL_2 = Register<0x605D, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_4_CHANNEL_3 = Register<0x605E, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_4_CHANNEL_4 = Register<0x605F, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_5_CHANNEL_1 = Register<0x6060, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_5_CHANNEL_2 = Register<0x6061, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_5_CHANNEL_3 = Register<0x6062, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_5_CHANNEL_4 = Register<0x6063, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_6_CHANNEL_1 = Register<0x6064, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_6_CHANNEL_2 = Register<0x6065, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_6_CHANNEL_3 = Register<0x6066, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_6_CHANNEL_4 = Register<0x6067, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_7_CHANNEL_1 = Register<0x6068, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_7_CHANNEL_2 = Register<0x6069, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_7_CHANNEL_3 = Register<0x606A, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_7_CHANNEL_4 = Register<0x606B, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_8_CHANNEL_1 = Register<0x606C, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_8_CHANNEL_2 = Register<0x606D, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_8_CHANNEL_3 = Register<0x606E, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_8_CHANNEL_4 = Register<0x606F, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_9_CHANNEL_1 = Register<0x6070, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_9_CHANNEL_2 = Register<0x6071, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_9_CHANNEL_3 = Register<0x6072, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_9_CHANNEL_4 = Register<0x6073, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_10_CHANNEL_1 = Register<0x6074, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_10_CHANNEL_2 = Register<0x6075, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_10_CHANNEL_3 = Register<0x6076, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_10_CHANNEL_4 = Register<0x6077, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_11_CHANNEL_1 = Register<0x6078, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_11_CHANNEL_2 = Register<0x6079, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_11_CHANNEL_3 = Register<0x607A, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_11_CHANNEL_4 = Register<0x607B, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_12_CHANNEL_1 = Register<0x607C, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_12_CHANNEL_2 = Register<0x607D, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_12_CHANNEL_3 = Register<0x607E, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_12_CHANNEL_4 = Register<0x607F, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_13_CHANNEL_1 = Register<0x6080, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_13_CHANNEL_2 = Register<0x6081, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_13_CHANNEL_3 = Register<0x6082, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_13_CHANNEL_4 = Register<0x6083, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_14_CHANNEL_1 = Register<0x6084, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_14_CHANNEL_2 = Register<0x6085, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_14_CHANNEL_3 = Register<0x6086, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_14_CHANNEL_4 = Register<0x6087, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_15_CHANNEL_1 = Register<0x6088, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_15_CHANNEL_2 = Register<0x6089, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_15_CHANNEL_3 = Register<0x608A, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_15_CHANNEL_4 = Register<0x608B, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_16_CHANNEL_1 = Register<0x608C, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_16_CHANNEL_2 = Register<0x608D, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_16_CHANNEL_3 = Register<0x608E, uint16_t, RegisterAccess::READ_ONLY>;
+using LOAD_CURRENT_MODULE_16_CHANNEL_4 = Register<0x608F, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_1_CHANNEL_1 = Register<0x6090, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_1_CHANNEL_2 = Register<0x6091, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_1_CHANNEL_3 = Register<0x6092, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_1_CHANNEL_4 = Register<0x6093, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_2_CHANNEL_1 = Register<0x6094, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_2_CHANNEL_2 = Register<0x6095, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_2_CHANNEL_3 = Register<0x6096, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_2_CHANNEL_4 = Register<0x6097, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_3_CHANNEL_1 = Register<0x6098, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_3_CHANNEL_2 = Register<0x6099, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_3_CHANNEL_3 = Register<0x609A, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_3_CHANNEL_4 = Register<0x609B, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_4_CHANNEL_1 = Register<0x609C, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_4_CHANNEL_2 = Register<0x609D, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_4_CHANNEL_3 = Register<0x609E, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_4_CHANNEL_4 = Register<0x609F, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_5_CHANNEL_1 = Register<0x60A0, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_5_CHANNEL_2 = Register<0x60A1, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_5_CHANNEL_3 = Register<0x60A2, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_5_CHANNEL_4 = Register<0x60A3, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_6_CHANNEL_1 = Register<0x60A4, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_6_CHANNEL_2 = Register<0x60A5, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_6_CHANNEL_3 = Register<0x60A6, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_6_CHANNEL_4 = Register<0x60A7, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_7_CHANNEL_1 = Register<0x60A8, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_7_CHANNEL_2 = Register<0x60A9, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_7_CHANNEL_3 = Register<0x60AA, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_7_CHANNEL_4 = Register<0x60AB, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_8_CHANNEL_1 = Register<0x60AC, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_8_CHANNEL_2 = Register<0x60AD, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_8_CHANNEL_3 = Register<0x60AE, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_8_CHANNEL_4 = Register<0x60AF, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_9_CHANNEL_1 = Register<0x60B0, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_9_CHANNEL_2 = Register<0x60B1, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_9_CHANNEL_3 = Register<0x60B2, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_9_CHANNEL_4 = Register<0x60B3, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_10_CHANNEL_1 = Register<0x60B4, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_10_CHANNEL_2 = Register<0x60B5, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_10_CHANNEL_3 = Register<0x60B6, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_10_CHANNEL_4 = Register<0x60B7, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_11_CHANNEL_1 = Register<0x60B8, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_11_CHANNEL_2 = Register<0x60B9, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_11_CHANNEL_3 = Register<0x60BA, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_11_CHANNEL_4 = Register<0x60BB, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_12_CHANNEL_1 = Register<0x60BC, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_12_CHANNEL_2 = Register<0x60BD, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_12_CHANNEL_3 = Register<0x60BE, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_12_CHANNEL_4 = Register<0x60BF, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_13_CHANNEL_1 = Register<0x60C0, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_13_CHANNEL_2 = Register<0x60C1, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_13_CHANNEL_3 = Register<0x60C2, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_13_CHANNEL_4 = Register<0x60C3, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_14_CHANNEL_1 = Register<0x60C4, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_14_CHANNEL_2 = Register<0x60C5, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_14_CHANNEL_3 = Register<0x60C6, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_14_CHANNEL_4 = Register<0x60C7, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_15_CHANNEL_1 = Register<0x60C8, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_15_CHANNEL_2 = Register<0x60C9, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_15_CHANNEL_3 = Register<0x60CA, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_15_CHANNEL_4 = Register<0x60CB, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_16_CHANNEL_1 = Register<0x60CC, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_16_CHANNEL_2 = Register<0x60CD, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_16_CHANNEL_3 = Register<0x60CE, uint16_t, RegisterAccess::READ_ONLY>;
+using ERROR_COUNTER_MODULE_16_CHANNEL_4 = Register<0x60CF, uint16_t, RegisterAccess::READ_ONLY>;
+using STATUS_FUNCTION_MODULE_PS = Register<0x7000, uint16_t, RegisterAccess::READ_ONLY>;
+using TOTAL_OPERATIONAL_RUNTIME_MSB_QUINT_POWER_SUPPLY = Register<0x7001, uint16_t, RegisterAccess::READ_ONLY>; // one word of a UINT32
+using TOTAL_OPERATIONAL_RUNTIME_LSB_QUINT_POWER_SUPPLY = Register<0x7002, uint16_t, RegisterAccess::READ_ONLY>; // one word of a UINT32
+using OPERATING_TIME_SINCE_LAST_RESTART_QUINT_POWER_SUPPLY = Register<0x7003, uint16_t, RegisterAccess::READ_ONLY>;
+using TEMPERATURE_IN_THE_DEVICE_QUINT_POWER_SUPPLY = Register<0x7004, uint16_t, RegisterAccess::READ_ONLY>;
+using REMAINING_LIFETIME_QUINT_POWER_SUPPLY = Register<0x7005, uint16_t, RegisterAccess::READ_ONLY>;
+using SOH_STATE_OF_HEALTH_QUINT_POWER_SUPPLY = Register<0x7006, uint16_t, RegisterAccess::READ_ONLY>;
+using IOL_CONNECTION_STATUS = Register<0x7007, uint16_t, RegisterAccess::READ_ONLY>;
+using INPUT_VOLTAGE_L1_L2 = Register<0x7008, uint16_t, RegisterAccess::READ_ONLY>;
+using INPUT_VOLTAGE_L2_L3 = Register<0x7009, uint16_t, RegisterAccess::READ_ONLY>;
+using INPUT_VOLTAGE_L3_L1 = Register<0x700A, uint16_t, RegisterAccess::READ_ONLY>;
+using INPUT_VOLTAGE_DC_QUINT_POWER_SUPPLY = Register<0x700B, uint16_t, RegisterAccess::READ_ONLY>;
+using FREQUENCY_QUINT_POWER_SUPPLY = Register<0x700C, uint16_t, RegisterAccess::READ_ONLY>;
+using OUTPUT_VOLTAGE_QUINT_POWER_SUPPLY = Register<0x700D, uint16_t, RegisterAccess::READ_ONLY>;
+using OUTPUT_CURRENT_QUINT_POWER_SUPPLY = Register<0x700E, uint16_t, RegisterAccess::READ_ONLY>;
+using SIGNALING_DATA_QUINT_POWER_SUPPLY = Register<0x700F, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMUM_OUTPUT_VOLTAGE_QUINT_POWER_SUPPLY = Register<0x7010, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMUM_OUTPUT_VOLTAGE_QUINT_POWER_SUPPLY = Register<0x7011, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMUM_STATIC_OUTPUT_CURRENT_QUINT_POWER_SUPPLY = Register<0x7012, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMUM_DYNAMIC_OUTPUT_CURRENT_QUINT_POWER_SUPPLY = Register<0x7013, uint16_t, RegisterAccess::READ_ONLY>;
+using MINIMUM_TEMPERATURE_KELVIN_QUINT_POWER_SUPPLY = Register<0x7014, uint16_t, RegisterAccess::READ_ONLY>;
+using MAXIMUM_TEMPERATURE_KELVIN_QUINT_POWER_SUPPLY = Register<0x7015, uint16_t, RegisterAccess::READ_ONLY>;
+using TRANSIENT_COUNTER_QUINT_POWER_SUPPLY = Register<0x7016, uint16_t, RegisterAccess::READ_ONLY>;
+using COUNTER_FOR_SFB_PULSES_QUINT_POWER_SUPPLY = Register<0x7017, uint16_t, RegisterAccess::READ_ONLY>;
+using COUNTER_FOR_OVP_QUINT_POWER_SUPPLY = Register<0x7018, uint16_t, RegisterAccess::READ_ONLY>;
+using COUNTER_FOR_DEVICE_START_QUINT_POWER_SUPPLY = Register<0x7019, uint16_t, RegisterAccess::READ_ONLY>;
+using COUNTER_FOR_DYNAMIC_BOOST_PULSES_QUINT_POWER_SUPPLY = Register<0x701A, uint16_t, RegisterAccess::READ_ONLY>;
+using SWITCH_ON_DELAY_BETWEEN_CHANNELS = Register<0xC000, uint16_t, RegisterAccess::READ_WRITE>;
+using GLOBAL_NOMINAL_CURRENT_PARAMETRIZATION_LOCK = Register<0xC001, uint16_t, RegisterAccess::READ_WRITE>;
+using LOCAL_USER_INTERFACE_LOCK = Register<0xC002, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_1_CHANNEL_1 = Register<0xC010, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_1_CHANNEL_2 = Register<0xC011, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_1_CHANNEL_3 = Register<0xC012, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_1_CHANNEL_4 = Register<0xC013, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_2_CHANNEL_1 = Register<0xC014, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_2_CHANNEL_2 = Register<0xC015, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_2_CHANNEL_3 = Register<0xC016, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_2_CHANNEL_4 = Register<0xC017, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_3_CHANNEL_1 = Register<0xC018, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_3_CHANNEL_2 = Register<0xC019, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_3_CHANNEL_3 = Register<0xC01A, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_3_CHANNEL_4 = Register<0xC01B, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_4_CHANNEL_1 = Register<0xC01C, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_4_CHANNEL_2 = Register<0xC01D, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_4_CHANNEL_3 = Register<0xC01E, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_4_CHANNEL_4 = Register<0xC01F, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_5_CHANNEL_1 = Register<0xC020, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_5_CHANNEL_2 = Register<0xC021, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_5_CHANNEL_3 = Register<0xC022, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_5_CHANNEL_4 = Register<0xC023, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_6_CHANNEL_1 = Register<0xC024, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_6_CHANNEL_2 = Register<0xC025, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_6_CHANNEL_3 = Register<0xC026, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_6_CHANNEL_4 = Register<0xC027, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_7_CHANNEL_1 = Register<0xC028, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_7_CHANNEL_2 = Register<0xC029, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_7_CHANNEL_3 = Register<0xC02A, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_7_CHANNEL_4 = Register<0xC02B, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_8_CHANNEL_1 = Register<0xC02C, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_8_CHANNEL_2 = Register<0xC02D, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_8_CHANNEL_3 = Register<0xC02E, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_8_CHANNEL_4 = Register<0xC02F, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_9_CHANNEL_1 = Register<0xC030, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_9_CHANNEL_2 = Register<0xC031, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_9_CHANNEL_3 = Register<0xC032, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_9_CHANNEL_4 = Register<0xC033, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_10_CHANNEL_1 = Register<0xC034, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_10_CHANNEL_2 = Register<0xC035, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_10_CHANNEL_3 = Register<0xC036, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_10_CHANNEL_4 = Register<0xC037, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_11_CHANNEL_1 = Register<0xC038, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_11_CHANNEL_2 = Register<0xC039, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_11_CHANNEL_3 = Register<0xC03A, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_11_CHANNEL_4 = Register<0xC03B, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_12_CHANNEL_1 = Register<0xC03C, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_12_CHANNEL_2 = Register<0xC03D, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_12_CHANNEL_3 = Register<0xC03E, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_12_CHANNEL_4 = Register<0xC03F, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_13_CHANNEL_1 = Register<0xC040, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_13_CHANNEL_2 = Register<0xC041, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_13_CHANNEL_3 = Register<0xC042, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_13_CHANNEL_4 = Register<0xC043, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_14_CHANNEL_1 = Register<0xC044, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_14_CHANNEL_2 = Register<0xC045, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_14_CHANNEL_3 = Register<0xC046, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_14_CHANNEL_4 = Register<0xC047, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_15_CHANNEL_1 = Register<0xC048, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_15_CHANNEL_2 = Register<0xC049, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_15_CHANNEL_3 = Register<0xC04A, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_15_CHANNEL_4 = Register<0xC04B, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_16_CHANNEL_1 = Register<0xC04C, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_16_CHANNEL_2 = Register<0xC04D, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_16_CHANNEL_3 = Register<0xC04E, uint16_t, RegisterAccess::READ_WRITE>;
+using CONTROL_CHANNEL_MODULE_16_CHANNEL_4 = Register<0xC04F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_1_CHANNEL_1 = Register<0xC050, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_1_CHANNEL_2 = Register<0xC051, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_1_CHANNEL_3 = Register<0xC052, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_1_CHANNEL_4 = Register<0xC053, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_2_CHANNEL_1 = Register<0xC054, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_2_CHANNEL_2 = Register<0xC055, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_2_CHANNEL_3 = Register<0xC056, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_2_CHANNEL_4 = Register<0xC057, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_3_CHANNEL_1 = Register<0xC058, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_3_CHANNEL_2 = Register<0xC059, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_3_CHANNEL_3 = Register<0xC05A, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_3_CHANNEL_4 = Register<0xC05B, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_4_CHANNEL_1 = Register<0xC05C, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_4_CHANNEL_2 = Register<0xC05D, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_4_CHANNEL_3 = Register<0xC05E, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_4_CHANNEL_4 = Register<0xC05F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_5_CHANNEL_1 = Register<0xC060, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_5_CHANNEL_2 = Register<0xC061, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_5_CHANNEL_3 = Register<0xC062, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_5_CHANNEL_4 = Register<0xC063, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_6_CHANNEL_1 = Register<0xC064, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_6_CHANNEL_2 = Register<0xC065, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_6_CHANNEL_3 = Register<0xC066, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_6_CHANNEL_4 = Register<0xC067, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_7_CHANNEL_1 = Register<0xC068, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_7_CHANNEL_2 = Register<0xC069, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_7_CHANNEL_3 = Register<0xC06A, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_7_CHANNEL_4 = Register<0xC06B, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_8_CHANNEL_1 = Register<0xC06C, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_8_CHANNEL_2 = Register<0xC06D, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_8_CHANNEL_3 = Register<0xC06E, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_8_CHANNEL_4 = Register<0xC06F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_9_CHANNEL_1 = Register<0xC070, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_9_CHANNEL_2 = Register<0xC071, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_9_CHANNEL_3 = Register<0xC072, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_9_CHANNEL_4 = Register<0xC073, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_10_CHANNEL_1 = Register<0xC074, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_10_CHANNEL_2 = Register<0xC075, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_10_CHANNEL_3 = Register<0xC076, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_10_CHANNEL_4 = Register<0xC077, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_11_CHANNEL_1 = Register<0xC078, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_11_CHANNEL_2 = Register<0xC079, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_11_CHANNEL_3 = Register<0xC07A, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_11_CHANNEL_4 = Register<0xC07B, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_12_CHANNEL_1 = Register<0xC07C, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_12_CHANNEL_2 = Register<0xC07D, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_12_CHANNEL_3 = Register<0xC07E, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_12_CHANNEL_4 = Register<0xC07F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_13_CHANNEL_1 = Register<0xC080, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_13_CHANNEL_2 = Register<0xC081, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_13_CHANNEL_3 = Register<0xC082, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_13_CHANNEL_4 = Register<0xC083, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_14_CHANNEL_1 = Register<0xC084, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_14_CHANNEL_2 = Register<0xC085, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_14_CHANNEL_3 = Register<0xC086, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_14_CHANNEL_4 = Register<0xC087, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_15_CHANNEL_1 = Register<0xC088, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_15_CHANNEL_2 = Register<0xC089, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_15_CHANNEL_3 = Register<0xC08A, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_15_CHANNEL_4 = Register<0xC08B, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_16_CHANNEL_1 = Register<0xC08C, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_16_CHANNEL_2 = Register<0xC08D, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_16_CHANNEL_3 = Register<0xC08E, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_MODULE_16_CHANNEL_4 = Register<0xC08F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_1_CHANNEL_1 = Register<0xC090, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_1_CHANNEL_2 = Register<0xC091, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_1_CHANNEL_3 = Register<0xC092, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_1_CHANNEL_4 = Register<0xC093, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_2_CHANNEL_1 = Register<0xC094, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_2_CHANNEL_2 = Register<0xC095, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_2_CHANNEL_3 = Register<0xC096, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_2_CHANNEL_4 = Register<0xC097, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_3_CHANNEL_1 = Register<0xC098, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_3_CHANNEL_2 = Register<0xC099, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_3_CHANNEL_3 = Register<0xC09A, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_3_CHANNEL_4 = Register<0xC09B, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_4_CHANNEL_1 = Register<0xC09C, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_4_CHANNEL_2 = Register<0xC09D, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_4_CHANNEL_3 = Register<0xC09E, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_4_CHANNEL_4 = Register<0xC09F, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_5_CHANNEL_1 = Register<0xC0A0, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_5_CHANNEL_2 = Register<0xC0A1, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_5_CHANNEL_3 = Register<0xC0A2, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_5_CHANNEL_4 = Register<0xC0A3, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_6_CHANNEL_1 = Register<0xC0A4, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_6_CHANNEL_2 = Register<0xC0A5, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_6_CHANNEL_3 = Register<0xC0A6, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_6_CHANNEL_4 = Register<0xC0A7, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_7_CHANNEL_1 = Register<0xC0A8, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_7_CHANNEL_2 = Register<0xC0A9, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_7_CHANNEL_3 = Register<0xC0AA, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_7_CHANNEL_4 = Register<0xC0AB, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_8_CHANNEL_1 = Register<0xC0AC, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_8_CHANNEL_2 = Register<0xC0AD, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_8_CHANNEL_3 = Register<0xC0AE, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_8_CHANNEL_4 = Register<0xC0AF, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_9_CHANNEL_1 = Register<0xC0B0, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_9_CHANNEL_2 = Register<0xC0B1, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_9_CHANNEL_3 = Register<0xC0B2, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_9_CHANNEL_4 = Register<0xC0B3, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_10_CHANNEL_1 = Register<0xC0B4, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_10_CHANNEL_2 = Register<0xC0B5, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_10_CHANNEL_3 = Register<0xC0B6, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_10_CHANNEL_4 = Register<0xC0B7, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_11_CHANNEL_1 = Register<0xC0B8, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_11_CHANNEL_2 = Register<0xC0B9, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_11_CHANNEL_3 = Register<0xC0BA, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_11_CHANNEL_4 = Register<0xC0BB, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_12_CHANNEL_1 = Register<0xC0BC, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_12_CHANNEL_2 = Register<0xC0BD, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_12_CHANNEL_3 = Register<0xC0BE, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_12_CHANNEL_4 = Register<0xC0BF, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_13_CHANNEL_1 = Register<0xC0C0, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_13_CHANNEL_2 = Register<0xC0C1, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_13_CHANNEL_3 = Register<0xC0C2, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_13_CHANNEL_4 = Register<0xC0C3, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_14_CHANNEL_1 = Register<0xC0C4, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_14_CHANNEL_2 = Register<0xC0C5, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_14_CHANNEL_3 = Register<0xC0C6, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_14_CHANNEL_4 = Register<0xC0C7, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_15_CHANNEL_1 = Register<0xC0C8, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_15_CHANNEL_2 = Register<0xC0C9, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_15_CHANNEL_3 = Register<0xC0CA, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_15_CHANNEL_4 = Register<0xC0CB, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_16_CHANNEL_1 = Register<0xC0CC, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_16_CHANNEL_2 = Register<0xC0CD, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_16_CHANNEL_3 = Register<0xC0CE, uint16_t, RegisterAccess::READ_WRITE>;
+using NOMINAL_CURRENT_PARAMETRIZATION_LOCK_MODULE_16_CHANNEL_4 = Register<0xC0CF, uint16_t, RegisterAccess::READ_WRITE>;
+using REG_D000 = Register<0xD000, uint16_t, RegisterAccess::READ_WRITE>;
+using PARAMETERS_SETTINGS_QUINT_POWER_SUPPLY = Register<0xD001, uint16_t, RegisterAccess::READ_WRITE>;
+using OUTPUT_CHARACTERISTIC_QUINT_POWER_SUPPLY = Register<0xD002, uint16_t, RegisterAccess::READ_WRITE>;
+using TRIPPING_CURRENT_FUSE_MODE_QUINT_POWER_SUPPLY = Register<0xD003, uint16_t, RegisterAccess::READ_WRITE>;
+using TRIPPING_TIME_FUSE_MODE_AND_SECURE_SHUT_OFF_QUINT_POWER_SUPP = Register<0xD004, uint16_t, RegisterAccess::READ_WRITE>;
+using SECURE_SHUT_OFF_TRIPPING_VOLTAGE_QUINT_POWER_SUPPLY = Register<0xD005, uint16_t, RegisterAccess::READ_WRITE>;
+using CONFIGURATION_OF_THE_GROUP_MESSAGE_FOR_RELAY_CONTACT_13_14_Q = Register<0xD006, uint16_t, RegisterAccess::READ_WRITE>;
+using THRESHOLD_VALUE_FOR_OUTPUT_VOLTAGE_QUINT_POWER_SUPPLY = Register<0xD007, uint16_t, RegisterAccess::READ_WRITE>;
+using THRESHOLD_VALUE_FOR_OUTPUT_POWER_QUINT_POWER_SUPPLY = Register<0xD008, uint16_t, RegisterAccess::READ_WRITE>;
+using STHRESHOLD_VALUE_FOR_OPERATING_TIME_QUINT_POWER_SUPPLY = Register<0xD009, uint16_t, RegisterAccess::READ_WRITE>;
+using THRESHOLD_VALUE_FOR_REMAINING_LIFETIME_QUINT_POWER_SUPPLY = Register<0xD00A, uint16_t, RegisterAccess::READ_WRITE>;
+
+} // namespace regs
+
+// Registers that exist once per module or per module channel
+namespace families {
+
+constexpr RegisterFamily RESETTING_THE_APPLICATION_PARAMETERS_TO_DEFAULT_SETTINGS_ALL_CHANNELS{"resetting_the_application_parameters_to_default_settings_all_channels", 0x0100, 0x1, 0, 16, 1, 1, RegisterType::UINT16, RegisterAccess::WRITE_ONLY};
+constexpr RegisterFamily CHANNEL_ERROR_RESET_ALL_CHANNELS{"channel_error_reset_all_channels", 0x0110, 0x1, 0, 16, 1, 1, RegisterType::UINT16, RegisterAccess::WRITE_ONLY};
+constexpr RegisterFamily ERROR_COUNTER_RESET{"error_counter_reset", 0x0120, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::WRITE_ONLY};
+constexpr RegisterFamily PRODUCT_NAME{"product_name", 0x1010, 0x10, 0, 16, 1, 16, RegisterType::STRING32, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily MODULE_ORDER_NO{"module_order_no", 0x1210, 0x10, 0, 16, 1, 16, RegisterType::STRING32, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily SERIAL_NUMBER{"serial_number", 0x1410, 0x10, 0, 16, 1, 16, RegisterType::STRING32, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily HARDWARE_VERSION{"hardware_version", 0x1610, 0x10, 0, 16, 1, 16, RegisterType::STRING32, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily FIRMWARE_VERSION{"firmware_version", 0x1810, 0x10, 0, 16, 1, 16, RegisterType::STRING32, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily NO_OF_CHANNELS{"no_of_channels", 0x2001, 0x1, 0, 16, 1, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily MINIMAL_NOMINAL_CURRENT{"minimal_nominal_current", 0x2020, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily MAXIMAL_NOMINAL_CURRENT{"maximal_nominal_current", 0x2060, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily STATUS{"status", 0x6010, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily LOAD_CURRENT{"load_current", 0x6050, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily ERROR_COUNTER{"error_counter", 0x6090, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY};
+constexpr RegisterFamily CONTROL_CHANNEL{"control_channel", 0xC010, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE};
+constexpr RegisterFamily NOMINAL_CURRENT{"nominal_current", 0xC050, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE};
+constexpr RegisterFamily NOMINAL_CURRENT_PARAMETRIZATION_LOCK{"nominal_current_parametrization_lock", 0xC090, 0x4, 1, 16, 4, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE};
+
+} // namespace families
+
+constexpr const RegisterFamily* register_family_table[] = {
+    &families::RESETTING_THE_APPLICATION_PARAMETERS_TO_DEFAULT_SETTINGS_ALL_CHANNELS,
+    &families::CHANNEL_ERROR_RESET_ALL_CHANNELS,
+    &families::ERROR_COUNTER_RESET,
+    &families::PRODUCT_NAME,
+    &families::MODULE_ORDER_NO,
+    &families::SERIAL_NUMBER,
+    &families::HARDWARE_VERSION,
+    &families::FIRMWARE_VERSION,
+    &families::NO_OF_CHANNELS,
+    &families::MINIMAL_NOMINAL_CURRENT,
+    &families::MAXIMAL_NOMINAL_CURRENT,
+    &families::STATUS,
+    &families::LOAD_CURRENT,
+    &families::ERROR_COUNTER,
+    &families::CONTROL_CHANNEL,
+    &families::NOMINAL_CURRENT,
+    &families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK,
+};
+constexpr size_t register_family_count = 17;
+
 // Register information table
 constexpr RegisterInfo register_table[] = {
     {0x0010, 1, RegisterType::UINT16, RegisterAccess::WRITE_ONLY,
@@ -1449,397 +2319,397 @@ constexpr RegisterInfo register_table[] = {
      " "},
     {0x2020, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 1 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2021, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 1 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2022, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 1 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2023, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 1 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2024, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 2 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2025, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 2 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2026, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 2 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2027, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 2 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2028, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 3 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2029, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 3 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 3 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 3 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 4 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 4 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 4 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x202F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 4 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2030, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 5 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2031, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 5 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2032, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 5 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2033, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 5 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2034, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 6 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2035, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 6 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2036, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 6 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2037, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 6 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2038, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 7 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2039, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 7 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 7 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 7 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 8 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 8 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 8 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x203F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 8 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2040, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 9 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2041, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 9 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2042, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 9 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2043, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 9 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2044, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 10 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2045, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 10 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2046, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 10 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2047, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 10 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2048, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 11 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2049, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 11 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 11 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 11 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 12 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 12 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 12 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x204F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 12 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2050, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 13 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2051, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 13 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2052, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 13 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2053, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 13 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2054, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 14 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2055, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 14 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2056, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 14 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2057, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 14 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2058, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 15 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2059, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 15 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 15 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 15 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 16 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 16 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 16 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x205F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimal nominal current Module 16 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2060, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 1 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2061, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 1 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2062, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 1 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2063, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 1 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2064, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 2 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2065, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 2 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2066, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 2 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2067, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 2 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2068, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 3 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2069, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 3 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 3 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 3 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 4 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 4 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 4 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x206F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 4 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2070, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 5 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2071, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 5 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2072, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 5 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2073, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 5 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2074, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 6 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2075, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 6 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2076, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 6 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2077, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 6 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2078, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 7 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2079, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 7 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 7 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 7 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 8 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 8 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 8 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x207F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 8 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2080, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 9 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2081, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 9 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2082, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 9 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2083, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 9 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2084, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 10 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2085, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 10 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2086, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 10 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2087, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 10 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2088, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 11 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2089, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 11 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 11 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 11 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 12 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 12 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 12 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x208F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 12 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2090, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 13 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2091, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 13 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2092, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 13 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2093, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 13 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2094, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 14 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2095, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 14 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2096, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 14 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2097, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 14 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2098, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 15 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x2099, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 15 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 15 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 15 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 16 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 16 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 16 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x209F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximal nominal current Module 16 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x6000, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Global status byte",
      "Bit0: Undervoltage; Bit1: Overvoltage; Bit2: CummulativeChannelError; Bit3: Cummulative 80% warning; Bit4: SystemCurrentTooHigh;"},
     {0x6001, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Total system current",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x6002, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Input voltage",
-     "[]=V"},
+     "[]=V", 0.01f, 0.0f, "V"},
     {0x6003, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "No. of currently connected modules",
      " "},
@@ -1848,19 +2718,19 @@ constexpr RegisterInfo register_table[] = {
      " "},
     {0x6005, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Sum of nominal currents",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0x6006, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Max. CAPAROC bus cycle (ms)",
-     "[]=ms"},
+     "[]=ms", 1.0f, 0.0f, "ms"},
     {0x6007, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Max. QUINT POWER bus cycle (ms)",
-     "[]=ms"},
+     "[]=ms", 1.0f, 0.0f, "ms"},
     {0x6008, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Hours since last boot",
-     "[]=h"},
+     "[]=h", 1.0f, 0.0f, "h"},
     {0x6009, 1, RegisterType::INT16, RegisterAccess::READ_ONLY,
      "Internal temperature",
-     "[]=°C"},
+     "[]=°C", 1.0f, 0.0f, "°C"},
     {0x6010, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Status Module 1 Channel 1",
      "Bit0: 80%Warning; Bit1: Overload; Bit2: ShortCircuit; Bit3: HardwareError; Bit4: VoltageError; Bit5: ModuleCurrentTooHigh; Bit6: SystemCurrentTooHigh"},
@@ -2055,196 +2925,196 @@ constexpr RegisterInfo register_table[] = {
      "Bit0: 80%Warning; Bit1: Overload; Bit2: ShortCircuit; Bit3: HardwareError; Bit4: VoltageError; Bit5: ModuleCurrentTooHigh; Bit6: SystemCurrentTooHigh"},
     {0x6050, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 1 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6051, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 1 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6052, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 1 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6053, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 1 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6054, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 2 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6055, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 2 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6056, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 2 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6057, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 2 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6058, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 3 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6059, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 3 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 3 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 3 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 4 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 4 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 4 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x605F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 4 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6060, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 5 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6061, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 5 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6062, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 5 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6063, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 5 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6064, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 6 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6065, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 6 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6066, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 6 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6067, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 6 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6068, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 7 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6069, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 7 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 7 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 7 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 8 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 8 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 8 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x606F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 8 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6070, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 9 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6071, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 9 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6072, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 9 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6073, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 9 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6074, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 10 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6075, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 10 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6076, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 10 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6077, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 10 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6078, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 11 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6079, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 11 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 11 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 11 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 12 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 12 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 12 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x607F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 12 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6080, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 13 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6081, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 13 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6082, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 13 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6083, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 13 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6084, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 14 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6085, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 14 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6086, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 14 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6087, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 14 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6088, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 15 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6089, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 15 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 15 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 15 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 16 Channel 1",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 16 Channel 2",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 16 Channel 3",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x608F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Load current Module 16 Channel 4",
-     "[]=mA, Resolution 100mA"},
+     "[]=mA, Resolution 100mA", 0.001f, 0.0f, "A"},
     {0x6090, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Error counter Module 1 Channel 1",
      "0…255"},
@@ -2448,61 +3318,61 @@ constexpr RegisterInfo register_table[] = {
      "[]=0,1h"},
     {0x7003, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Operating time since last restart Quint Power Supply",
-     "[]=0,1h"},
+     "[]=0,1h", 0.1f, 0.0f, "h"},
     {0x7004, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Temperature in the device QUINT Power Supply",
-     "[]=K"},
+     "[]=K", 1.0f, -273.15f, "°C"},
     {0x7005, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Remaining lifetime QUINT Power Supply",
-     "[]=d"},
+     "[]=d", 1.0f, 0.0f, "d"},
     {0x7006, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "SOH (State of Health) QUINT Power Supply",
-     "[]=0,01%"},
+     "[]=0,01%", 0.01f, 0.0f, "%"},
     {0x7007, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "IOL connection status",
      "0: IOL connected, 1: IOL not connected"},
     {0x7008, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Input voltage L1 --> L2",
-     "[]=V"},
+     "[]=V", 1.0f, 0.0f, "V"},
     {0x7009, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Input voltage L2 --> L3",
-     "[]=V"},
+     "[]=V", 1.0f, 0.0f, "V"},
     {0x700A, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Input voltage L3 --> L1",
-     "[]=V"},
+     "[]=V", 1.0f, 0.0f, "V"},
     {0x700B, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Input voltage DC QUINT Power Supply",
-     "[]=V"},
+     "[]=V", 1.0f, 0.0f, "V"},
     {0x700C, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Frequency QUINT Power Supply",
-     "[]=Hz"},
+     "[]=Hz", 1.0f, 0.0f, "Hz"},
     {0x700D, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Output voltage QUINT Power Supply",
-     "[]= 0,01 V"},
+     "[]= 0,01 V", 0.01f, 0.0f, "V"},
     {0x700E, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Output Current QUINT Power Supply",
-     "[]= 0,01 A"},
+     "[]= 0,01 A", 0.01f, 0.0f, "A"},
     {0x700F, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Signaling data QUINT Power Supply",
      "Bit 0: Status Relais FALSE: Closed TRUE: Open  Bit 1-2: Stat. LED1 (DC OK) 0b00: OFF  0b01: ON  0b10: BLINKING  0b11: future use Bit 3-4: Stat. LED2 (>50%) 0b00: OFF  0b01: ON  0b10: BLINKING  0b11: future use Bit 5-6: Stat. LED3 (>75%) 0b00: OFF  0b01: ON  0b10: BLINKING  0b11: future use Bit 7-8: Stat. LED4 (>100%) 0b00: OFF  0b01: ON  0b10: BLINKING  0b11: future use Bit 9-10: Stat. LED5 (IO-Link) 0b00: OFF  0b01: ON  0b10: BLINKING  0b11: future use Bit 11-15: Reserved (0)"},
     {0x7010, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimum output voltage QUINT Power Supply",
-     "[]= 0,01 V"},
+     "[]= 0,01 V", 0.01f, 0.0f, "V"},
     {0x7011, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximum output voltage QUINT Power Supply",
-     "[]= 0,01 V"},
+     "[]= 0,01 V", 0.01f, 0.0f, "V"},
     {0x7012, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximum static output current QUINT Power Supply",
-     "[]= 0,01 V"},
+     "[]= 0,01 V", 0.01f, 0.0f, "A"},
     {0x7013, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximum dynamic output current QUINT Power Supply",
-     "[]= 0,01 V"},
+     "[]= 0,01 V", 0.01f, 0.0f, "A"},
     {0x7014, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Minimum temperature (Kelvin) QUINT Power Supply",
-     "[]=K"},
+     "[]=K", 1.0f, -273.15f, "°C"},
     {0x7015, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Maximum temperature (Kelvin) QUINT Power Supply",
-     "[]=K"},
+     "[]=K", 1.0f, -273.15f, "°C"},
     {0x7016, 1, RegisterType::UINT16, RegisterAccess::READ_ONLY,
      "Transient counter QUINT Power Supply",
      " "},
@@ -2520,7 +3390,7 @@ constexpr RegisterInfo register_table[] = {
      " "},
     {0xC000, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Switch on delay between channels",
-     "0...10000ms"},
+     "0...10000ms", 1.0f, 0.0f, "ms"},
     {0xC001, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Global nominal current parametrization lock",
      " "},
@@ -2721,196 +3591,196 @@ constexpr RegisterInfo register_table[] = {
      "0: off; 1: on"},
     {0xC050, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 1 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC051, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 1 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC052, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 1 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC053, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 1 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC054, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 2 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC055, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 2 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC056, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 2 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC057, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 2 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC058, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 3 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC059, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 3 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05A, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 3 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05B, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 3 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05C, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 4 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05D, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 4 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05E, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 4 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC05F, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 4 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC060, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 5 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC061, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 5 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC062, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 5 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC063, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 5 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC064, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 6 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC065, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 6 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC066, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 6 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC067, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 6 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC068, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 7 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC069, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 7 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06A, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 7 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06B, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 7 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06C, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 8 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06D, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 8 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06E, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 8 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC06F, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 8 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC070, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 9 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC071, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 9 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC072, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 9 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC073, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 9 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC074, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 10 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC075, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 10 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC076, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 10 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC077, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 10 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC078, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 11 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC079, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 11 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07A, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 11 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07B, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 11 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07C, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 12 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07D, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 12 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07E, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 12 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC07F, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 12 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC080, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 13 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC081, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 13 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC082, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 13 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC083, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 13 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC084, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 14 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC085, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 14 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC086, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 14 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC087, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 14 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC088, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 15 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC089, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 15 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08A, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 15 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08B, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 15 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08C, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 16 Channel 1",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08D, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 16 Channel 2",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08E, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 16 Channel 3",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC08F, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal Current Module 16 Channel 4",
-     "[]=A"},
+     "[]=A", 1.0f, 0.0f, "A"},
     {0xC090, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Nominal current parametrization lock Module 1 Channel 1",
      "0: unlocked; 1: locked"},
@@ -3105,7 +3975,7 @@ constexpr RegisterInfo register_table[] = {
      "0: unlocked; 1: locked"},
     {0xD000, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Output Voltage QUINT Power Supply",
-     "2390 ... 2960 [0,01*V], Default: 2410"},
+     "2390 ... 2960 [0,01*V], Default: 2410", 0.01f, 0.0f, "V"},
     {0xD001, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Parameters settings QUINT Power Supply",
      "Bit 0: Parallelmode  0: Parallelmode inactive 1: Parallelmode active Bit 1: Button Lock 0: unlocked 1: locked Bit 2: Factory Settings 0: No reset 1: Reset to Factory"},
@@ -3114,30 +3984,2679 @@ constexpr RegisterInfo register_table[] = {
      "Bit0: SFB Bit1: DB Bit2: SB Bit3: Reserved Bit4…6: 1: UI Advanced (0bx001xxxx) 2: FuseMode Current (0bx010xxxx) 3: Secure shut off / FuseMode Voltage (0bx011xxxx) 4: Smart Hiccup (0bx100xxxx) Bit7: Reserved"},
     {0xD003, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Tripping current FUSE MODE QUINT Power Supply",
-     "25...125 [1 %], Default 100"},
+     "25...125 [1 %], Default 100", 1.0f, 0.0f, "%"},
     {0xD004, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Tripping time FUSE MODE and Secure shut-off QUINT Power Supply",
-     "1...1200 [0,01 s], Default 1"},
+     "1...1200 [0,01 s], Default 1", 0.01f, 0.0f, "s"},
     {0xD005, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Secure shut-off tripping voltage QUINT Power Supply",
-     "40...90 [1 %], Default 75"},
+     "40...90 [1 %], Default 75", 1.0f, 0.0f, "%"},
     {0xD006, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Configuration of the group message for relay contact 13/14 QUINT Power Supply",
      "\"Bit 0: Relay 13/14: Enable Output voltage (DC OK) 0: Disale 1: Enable\" \"Bit 1: Relay 13/14: Enable Output current (P<Pnenn) 0: Disale 1: Enable\" \"Bit 2: Relay 13/14: Enable Operating hours  0: Disale 1: Enable\" \"Bit 3: Relay 13/14: Enable Temperature OK 0: Disale 1: Enable\" \"Bit 4: Relay 13/14: Enable Input Voltage OK 0: Disale 1: Enable\" \"Bit 5: Relay 13/14: Enable Overvoltage Protection activated 0: Disale 1: Enable\" \"Bit 6: Relay 13/14: Enable Phase monitoring (2AC/3AC) 0: Disale 1: Enable\" \"Bit 7: Relay 13/14: Enable RemainingLifetime 0: Disale 1: Enable\" \"Bit 8: Phasesequence 0: Disable 1: Enable\" Bit 15: Relay 13/14: Invert Total Default: 0x0001 (Volt.Err)"},
     {0xD007, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Threshold value for output voltage QUINT Power Supply",
-     "25...135 [1 %], Default: 90"},
+     "25...135 [1 %], Default: 90", 1.0f, 0.0f, "%"},
     {0xD008, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Threshold value for output power QUINT Power Supply",
-     "5...200 [1 %], Default: 100"},
+     "5...200 [1 %], Default: 100", 1.0f, 0.0f, "%"},
     {0xD009, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "SThreshold value for operating time QUINT Power Supply",
-     "0...65535 [1 d], Default: 3650"},
+     "0...65535 [1 d], Default: 3650", 1.0f, 0.0f, "d"},
     {0xD00A, 1, RegisterType::UINT16, RegisterAccess::READ_WRITE,
      "Threshold value for remaining lifetime QUINT Power Supply",
-     "0...5475 [1 d], Default: 0"},
+     "0...5475 [1 d], Default: 0", 1.0f, 0.0f, "d"},
 };
 constexpr size_t register_table_size = 771;
 
+// Address index: register_page_index[address >> 8] selects a row of register_page_slots
+// (register_page_none if no register starts in that page), whose entry at address & 0xFF
+// is the register_table index + 1 of the register starting at address (0: none)
+constexpr uint8_t register_page_none = 0xFF;
+constexpr size_t register_page_count = 17;
+
+constexpr uint8_t register_page_index[256] = {
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint16_t register_page_slots[register_page_count][256] = {
+    { // 0x0000-0x00FF
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x0100-0x01FF
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+        22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+        38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+        54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+        70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+        86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1000-0x10FF
+        102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1100-0x11FF
+        118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1200-0x12FF
+        120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1300-0x13FF
+        136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1400-0x14FF
+        138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1500-0x15FF
+        154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1600-0x16FF
+        156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1700-0x17FF
+        172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1800-0x18FF
+        174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x1900-0x19FF
+        190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x2000-0x20FF
+        192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+        208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+        225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240,
+        241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+        257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272,
+        273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288,
+        289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+        305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+        321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x6000-0x60FF
+        337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 0, 0, 0, 0, 0, 0,
+        347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362,
+        363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+        379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+        395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+        411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+        427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+        443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+        475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+        491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+        507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
+        523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0x7000-0x70FF
+        539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+        555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0xC000-0xC0FF
+        566, 567, 568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
+        585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+        601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+        617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632,
+        633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+        649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664,
+        665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680,
+        681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696,
+        697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712,
+        713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728,
+        729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744,
+        745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { // 0xD000-0xD0FF
+        761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+/**
+ * @brief Find the register starting at an address in constant time
+ *
+ * @param address Register address
+ * @return const RegisterInfo* Entry of register_table, nullptr if no register starts at address
+ */
+constexpr const RegisterInfo* find_register_info(uint16_t address) {
+    const uint8_t page = register_page_index[address >> 8];
+    if (page == register_page_none) {
+        return nullptr;
+    }
+    const uint16_t slot = register_page_slots[page][address & 0xFF];
+    return slot != 0 ? &register_table[slot - 1] : nullptr;
+}
+
+/**
+ * @brief Register starting at an address known at compile time
+ *
+ * Fails to compile if no register starts at address.
+ *
+ * @param address Register address
+ * @return const RegisterInfo& Entry of register_table
+ */
+consteval const RegisterInfo& static_register_info(uint16_t address) {
+    const RegisterInfo* info = find_register_info(address);
+    if (info == nullptr) {
+        throw "no register starts at this address";
+    }
+    return *info;
+}
+
+// Lowercase names and descriptions, parallel to register_table
+constexpr const char* register_names_lower[] = {
+    "resetting the application parameters to default settings (power module and all circuit breaker modules)",
+    "global channel error reset (all circuit breaker modules)",
+    "error counter reset (all circuit breaker modules)",
+    "resetting the application parameters to default settings (quint power supply)",
+    "reset statistics (quint power supply)",
+    " resetting the application parameters to default settings module 1 all channels",
+    " resetting the application parameters to default settings module 2 all channels",
+    " resetting the application parameters to default settings module 3 all channels",
+    " resetting the application parameters to default settings module 4 all channels",
+    " resetting the application parameters to default settings module 5 all channels",
+    " resetting the application parameters to default settings module 6 all channels",
+    " resetting the application parameters to default settings module 7 all channels",
+    " resetting the application parameters to default settings module 8 all channels",
+    " resetting the application parameters to default settings module 9 all channels",
+    " resetting the application parameters to default settings module 10 all channels",
+    " resetting the application parameters to default settings module 11 all channels",
+    " resetting the application parameters to default settings module 12 all channels",
+    " resetting the application parameters to default settings module 13 all channels",
+    " resetting the application parameters to default settings module 14 all channels",
+    " resetting the application parameters to default settings module 15 all channels",
+    " resetting the application parameters to default settings module 16 all channels",
+    "channel error reset module 1 all channels",
+    "channel error reset module 2 all channels",
+    "channel error reset module 3 all channels",
+    "channel error reset module 4 all channels",
+    "channel error reset module 5 all channels",
+    "channel error reset module 6 all channels",
+    "channel error reset module 7 all channels",
+    "channel error reset module 8 all channels",
+    "channel error reset module 9 all channels",
+    "channel error reset module 10 all channels",
+    "channel error reset module 11 all channels",
+    "channel error reset module 12 all channels",
+    "channel error reset module 13 all channels",
+    "channel error reset module 14 all channels",
+    "channel error reset module 15 all channels",
+    "channel error reset module 16 all channels",
+    "error counter reset module 1 channel 1",
+    "error counter reset module 1 channel 2",
+    "error counter reset module 1 channel 3",
+    "error counter reset module 1 channel 4",
+    "error counter reset module 2 channel 1",
+    "error counter reset module 2 channel 2",
+    "error counter reset module 2 channel 3",
+    "error counter reset module 2 channel 4",
+    "error counter reset module 3 channel 1",
+    "error counter reset module 3 channel 2",
+    "error counter reset module 3 channel 3",
+    "error counter reset module 3 channel 4",
+    "error counter reset module 4 channel 1",
+    "error counter reset module 4 channel 2",
+    "error counter reset module 4 channel 3",
+    "error counter reset module 4 channel 4",
+    "error counter reset module 5 channel 1",
+    "error counter reset module 5 channel 2",
+    "error counter reset module 5 channel 3",
+    "error counter reset module 5 channel 4",
+    "error counter reset module 6 channel 1",
+    "error counter reset module 6 channel 2",
+    "error counter reset module 6 channel 3",
+    "error counter reset module 6 channel 4",
+    "error counter reset module 7 channel 1",
+    "error counter reset module 7 channel 2",
+    "error counter reset module 7 channel 3",
+    "error counter reset module 7 channel 4",
+    "error counter reset module 8 channel 1",
+    "error counter reset module 8 channel 2",
+    "error counter reset module 8 channel 3",
+    "error counter reset module 8 channel 4",
+    "error counter reset module 9 channel 1",
+    "error counter reset module 9 channel 2",
+    "error counter reset module 9 channel 3",
+    "error counter reset module 9 channel 4",
+    "error counter reset module 10 channel 1",
+    "error counter reset module 10 channel 2",
+    "error counter reset module 10 channel 3",
+    "error counter reset module 10 channel 4",
+    "error counter reset module 11 channel 1",
+    "error counter reset module 11 channel 2",
+    "error counter reset module 11 channel 3",
+    "error counter reset module 11 channel 4",
+    "error counter reset module 12 channel 1",
+    "error counter reset module 12 channel 2",
+    "error counter reset module 12 channel 3",
+    "error counter reset module 12 channel 4",
+    "error counter reset module 13 channel 1",
+    "error counter reset module 13 channel 2",
+    "error counter reset module 13 channel 3",
+    "error counter reset module 13 channel 4",
+    "error counter reset module 14 channel 1",
+    "error counter reset module 14 channel 2",
+    "error counter reset module 14 channel 3",
+    "error counter reset module 14 channel 4",
+    "error counter reset module 15 channel 1",
+    "error counter reset module 15 channel 2",
+    "error counter reset module 15 channel 3",
+    "error counter reset module 15 channel 4",
+    "error counter reset module 16 channel 1",
+    "error counter reset module 16 channel 2",
+    "error counter reset module 16 channel 3",
+    "error counter reset module 16 channel 4",
+    "product name power module",
+    "product name module 1",
+    "product name module 2",
+    "product name module 3",
+    "product name module 4",
+    "product name module 5",
+    "product name module 6",
+    "product name module 7",
+    "product name module 8",
+    "product name module 9",
+    "product name module 10",
+    "product name module 11",
+    "product name module 12",
+    "product name module 13",
+    "product name module 14",
+    "product name module 15",
+    "product name module 16",
+    "product name quint power supply",
+    "product id power module",
+    "module order no.  module 1",
+    "module order no.  module 2",
+    "module order no.  module 3",
+    "module order no.  module 4",
+    "module order no.  module 5",
+    "module order no.  module 6",
+    "module order no.  module 7",
+    "module order no.  module 8",
+    "module order no.  module 9",
+    "module order no.  module 10",
+    "module order no.  module 11",
+    "module order no.  module 12",
+    "module order no.  module 13",
+    "module order no.  module 14",
+    "module order no.  module 15",
+    "module order no.  module 16",
+    "product id quint power supply",
+    "serial number power module",
+    "serial number module 1",
+    "serial number module 2",
+    "serial number module 3",
+    "serial number module 4",
+    "serial number module 5",
+    "serial number module 6",
+    "serial number module 7",
+    "serial number module 8",
+    "serial number module 9",
+    "serial number module 10",
+    "serial number module 11",
+    "serial number module 12",
+    "serial number module 13",
+    "serial number module 14",
+    "serial number module 15",
+    "serial number module 16",
+    "serial number quint power supply",
+    "hardware version power module",
+    "hardware version module 1",
+    "hardware version module 2",
+    "hardware version module 3",
+    "hardware version module 4",
+    "hardware version module 5",
+    "hardware version module 6",
+    "hardware version module 7",
+    "hardware version module 8",
+    "hardware version module 9",
+    "hardware version module 10",
+    "hardware version module 11",
+    "hardware version module 12",
+    "hardware version module 13",
+    "hardware version module 14",
+    "hardware version module 15",
+    "hardware version module 16",
+    "hardware version quint power supply",
+    "firmware revision power module",
+    "firmware version module 1",
+    "firmware version module 2",
+    "firmware version module 3",
+    "firmware version module 4",
+    "firmware version module 5",
+    "firmware version module 6",
+    "firmware version module 7",
+    "firmware version module 8",
+    "firmware version module 9",
+    "firmware version module 10",
+    "firmware version module 11",
+    "firmware version module 12",
+    "firmware version module 13",
+    "firmware version module 14",
+    "firmware version module 15",
+    "firmware version module 16",
+    "firmware version quint power supply",
+    "no. of currently connected modules",
+    "no. of channels module 1",
+    "no. of channels module 2",
+    "no. of channels module 3",
+    "no. of channels module 4",
+    "no. of channels module 5",
+    "no. of channels module 6",
+    "no. of channels module 7",
+    "no. of channels module 8",
+    "no. of channels module 9",
+    "no. of channels module 10",
+    "no. of channels module 11",
+    "no. of channels module 12",
+    "no. of channels module 13",
+    "no. of channels module 14",
+    "no. of channels module 15",
+    "no. of channels module 16",
+    "minimal nominal current module 1 channel 1",
+    "minimal nominal current module 1 channel 2",
+    "minimal nominal current module 1 channel 3",
+    "minimal nominal current module 1 channel 4",
+    "minimal nominal current module 2 channel 1",
+    "minimal nominal current module 2 channel 2",
+    "minimal nominal current module 2 channel 3",
+    "minimal nominal current module 2 channel 4",
+    "minimal nominal current module 3 channel 1",
+    "minimal nominal current module 3 channel 2",
+    "minimal nominal current module 3 channel 3",
+    "minimal nominal current module 3 channel 4",
+    "minimal nominal current module 4 channel 1",
+    "minimal nominal current module 4 channel 2",
+    "minimal nominal current module 4 channel 3",
+    "minimal nominal current module 4 channel 4",
+    "minimal nominal current module 5 channel 1",
+    "minimal nominal current module 5 channel 2",
+    "minimal nominal current module 5 channel 3",
+    "minimal nominal current module 5 channel 4",
+    "minimal nominal current module 6 channel 1",
+    "minimal nominal current module 6 channel 2",
+    "minimal nominal current module 6 channel 3",
+    "minimal nominal current module 6 channel 4",
+    "minimal nominal current module 7 channel 1",
+    "minimal nominal current module 7 channel 2",
+    "minimal nominal current module 7 channel 3",
+    "minimal nominal current module 7 channel 4",
+    "minimal nominal current module 8 channel 1",
+    "minimal nominal current module 8 channel 2",
+    "minimal nominal current module 8 channel 3",
+    "minimal nominal current module 8 channel 4",
+    "minimal nominal current module 9 channel 1",
+    "minimal nominal current module 9 channel 2",
+    "minimal nominal current module 9 channel 3",
+    "minimal nominal current module 9 channel 4",
+    "minimal nominal current module 10 channel 1",
+    "minimal nominal current module 10 channel 2",
+    "minimal nominal current module 10 channel 3",
+    "minimal nominal current module 10 channel 4",
+    "minimal nominal current module 11 channel 1",
+    "minimal nominal current module 11 channel 2",
+    "minimal nominal current module 11 channel 3",
+    "minimal nominal current module 11 channel 4",
+    "minimal nominal current module 12 channel 1",
+    "minimal nominal current module 12 channel 2",
+    "minimal nominal current module 12 channel 3",
+    "minimal nominal current module 12 channel 4",
+    "minimal nominal current module 13 channel 1",
+    "minimal nominal current module 13 channel 2",
+    "minimal nominal current module 13 channel 3",
+    "minimal nominal current module 13 channel 4",
+    "minimal nominal current module 14 channel 1",
+    "minimal nominal current module 14 channel 2",
+    "minimal nominal current module 14 channel 3",
+    "minimal nominal current module 14 channel 4",
+    "minimal nominal current module 15 channel 1",
+    "minimal nominal current module 15 channel 2",
+    "minimal nominal current module 15 channel 3",
+    "minimal nominal current module 15 channel 4",
+    "minimal nominal current module 16 channel 1",
+    "minimal nominal current module 16 channel 2",
+    "minimal nominal current module 16 channel 3",
+    "minimal nominal current module 16 channel 4",
+    "maximal nominal current module 1 channel 1",
+    "maximal nominal current module 1 channel 2",
+    "maximal nominal current module 1 channel 3",
+    "maximal nominal current module 1 channel 4",
+    "maximal nominal current module 2 channel 1",
+    "maximal nominal current module 2 channel 2",
+    "maximal nominal current module 2 channel 3",
+    "maximal nominal current module 2 channel 4",
+    "maximal nominal current module 3 channel 1",
+    "maximal nominal current module 3 channel 2",
+    "maximal nominal current module 3 channel 3",
+    "maximal nominal current module 3 channel 4",
+    "maximal nominal current module 4 channel 1",
+    "maximal nominal current module 4 channel 2",
+    "maximal nominal current module 4 channel 3",
+    "maximal nominal current module 4 channel 4",
+    "maximal nominal current module 5 channel 1",
+    "maximal nominal current module 5 channel 2",
+    "maximal nominal current module 5 channel 3",
+    "maximal nominal current module 5 channel 4",
+    "maximal nominal current module 6 channel 1",
+    "maximal nominal current module 6 channel 2",
+    "maximal nominal current module 6 channel 3",
+    "maximal nominal current module 6 channel 4",
+    "maximal nominal current module 7 channel 1",
+    "maximal nominal current module 7 channel 2",
+    "maximal nominal current module 7 channel 3",
+    "maximal nominal current module 7 channel 4",
+    "maximal nominal current module 8 channel 1",
+    "maximal nominal current module 8 channel 2",
+    "maximal nominal current module 8 channel 3",
+    "maximal nominal current module 8 channel 4",
+    "maximal nominal current module 9 channel 1",
+    "maximal nominal current module 9 channel 2",
+    "maximal nominal current module 9 channel 3",
+    "maximal nominal current module 9 channel 4",
+    "maximal nominal current module 10 channel 1",
+    "maximal nominal current module 10 channel 2",
+    "maximal nominal current module 10 channel 3",
+    "maximal nominal current module 10 channel 4",
+    "maximal nominal current module 11 channel 1",
+    "maximal nominal current module 11 channel 2",
+    "maximal nominal current module 11 channel 3",
+    "maximal nominal current module 11 channel 4",
+    "maximal nominal current module 12 channel 1",
+    "maximal nominal current module 12 channel 2",
+    "maximal nominal current module 12 channel 3",
+    "maximal nominal current module 12 channel 4",
+    "maximal nominal current module 13 channel 1",
+    "maximal nominal current module 13 channel 2",
+    "maximal nominal current module 13 channel 3",
+    "maximal nominal current module 13 channel 4",
+    "maximal nominal current module 14 channel 1",
+    "maximal nominal current module 14 channel 2",
+    "maximal nominal current module 14 channel 3",
+    "maximal nominal current module 14 channel 4",
+    "maximal nominal current module 15 channel 1",
+    "maximal nominal current module 15 channel 2",
+    "maximal nominal current module 15 channel 3",
+    "maximal nominal current module 15 channel 4",
+    "maximal nominal current module 16 channel 1",
+    "maximal nominal current module 16 channel 2",
+    "maximal nominal current module 16 channel 3",
+    "maximal nominal current module 16 channel 4",
+    "global status byte",
+    "total system current",
+    "input voltage",
+    "no. of currently connected modules",
+    "no. of connected modules at boot",
+    "sum of nominal currents",
+    "max. caparoc bus cycle (ms)",
+    "max. quint power bus cycle (ms)",
+    "hours since last boot",
+    "internal temperature",
+    "status module 1 channel 1",
+    "status module 1 channel 2",
+    "status module 1 channel 3",
+    "status module 1 channel 4",
+    "status module 2 channel 1",
+    "status module 2 channel 2",
+    "status module 2 channel 3",
+    "status module 2 channel 4",
+    "status module 3 channel 1",
+    "status module 3 channel 2",
+    "status module 3 channel 3",
+    "status module 3 channel 4",
+    "status module 4 channel 1",
+    "status module 4 channel 2",
+    "status module 4 channel 3",
+    "status module 4 channel 4",
+    "status module 5 channel 1",
+    "status module 5 channel 2",
+    "status module 5 channel 3",
+    "status module 5 channel 4",
+    "status module 6 channel 1",
+    "status module 6 channel 2",
+    "status module 6 channel 3",
+    "status module 6 channel 4",
+    "status module 7 channel 1",
+    "status module 7 channel 2",
+    "status module 7 channel 3",
+    "status module 7 channel 4",
+    "status module 8 channel 1",
+    "status module 8 channel 2",
+    "status module 8 channel 3",
+    "status module 8 channel 4",
+    "status module 9 channel 1",
+    "status module 9 channel 2",
+    "status module 9 channel 3",
+    "status module 9 channel 4",
+    "status module 10 channel 1",
+    "status module 10 channel 2",
+    "status module 10 channel 3",
+    "status module 10 channel 4",
+    "status module 11 channel 1",
+    "status module 11 channel 2",
+    "status module 11 channel 3",
+    "status module 11 channel 4",
+    "status module 12 channel 1",
+    "status module 12 channel 2",
+    "status module 12 channel 3",
+    "status module 12 channel 4",
+    "status module 13 channel 1",
+    "status module 13 channel 2",
+    "status module 13 channel 3",
+    "status module 13 channel 4",
+    "status module 14 channel 1",
+    "status module 14 channel 2",
+    "status module 14 channel 3",
+    "status module 14 channel 4",
+    "status module 15 channel 1",
+    "status module 15 channel 2",
+    "status module 15 channel 3",
+    "status module 15 channel 4",
+    "status module 16 channel 1",
+    "status module 16 channel 2",
+    "status module 16 channel 3",
+    "status module 16 channel 4",
+    "load current module 1 channel 1",
+    "load current module 1 channel 2",
+    "load current module 1 channel 3",
+    "load current module 1 channel 4",
+    "load current module 2 channel 1",
+    "load current module 2 channel 2",
+    "load current module 2 channel 3",
+    "load current module 2 channel 4",
+    "load current module 3 channel 1",
+    "load current module 3 channel 2",
+    "load current module 3 channel 3",
+    "load current module 3 channel 4",
+    "load current module 4 channel 1",
+    "load current module 4 channel 2",
+    "load current module 4 channel 3",
+    "load current module 4 channel 4",
+    "load current module 5 channel 1",
+    "load current module 5 channel 2",
+    "load current module 5 channel 3",
+    "load current module 5 channel 4",
+    "load current module 6 channel 1",
+    "load current module 6 channel 2",
+    "load current module 6 channel 3",
+    "load current module 6 channel 4",
+    "load current module 7 channel 1",
+    "load current module 7 channel 2",
+    "load current module 7 channel 3",
+    "load current module 7 channel 4",
+    "load current module 8 channel 1",
+    "load current module 8 channel 2",
+    "load current module 8 channel 3",
+    "load current module 8 channel 4",
+    "load current module 9 channel 1",
+    "load current module 9 channel 2",
+    "load current module 9 channel 3",
+    "load current module 9 channel 4",
+    "load current module 10 channel 1",
+    "load current module 10 channel 2",
+    "load current module 10 channel 3",
+    "load current module 10 channel 4",
+    "load current module 11 channel 1",
+    "load current module 11 channel 2",
+    "load current module 11 channel 3",
+    "load current module 11 channel 4",
+    "load current module 12 channel 1",
+    "load current module 12 channel 2",
+    "load current module 12 channel 3",
+    "load current module 12 channel 4",
+    "load current module 13 channel 1",
+    "load current module 13 channel 2",
+    "load current module 13 channel 3",
+    "load current module 13 channel 4",
+    "load current module 14 channel 1",
+    "load current module 14 channel 2",
+    "load current module 14 channel 3",
+    "load current module 14 channel 4",
+    "load current module 15 channel 1",
+    "load current module 15 channel 2",
+    "load current module 15 channel 3",
+    "load current module 15 channel 4",
+    "load current module 16 channel 1",
+    "load current module 16 channel 2",
+    "load current module 16 channel 3",
+    "load current module 16 channel 4",
+    "error counter module 1 channel 1",
+    "error counter module 1 channel 2",
+    "error counter module 1 channel 3",
+    "error counter module 1 channel 4",
+    "error counter module 2 channel 1",
+    "error counter module 2 channel 2",
+    "error counter module 2 channel 3",
+    "error counter module 2 channel 4",
+    "error counter module 3 channel 1",
+    "error counter module 3 channel 2",
+    "error counter module 3 channel 3",
+    "error counter module 3 channel 4",
+    "error counter module 4 channel 1",
+    "error counter module 4 channel 2",
+    "error counter module 4 channel 3",
+    "error counter module 4 channel 4",
+    "error counter module 5 channel 1",
+    "error counter module 5 channel 2",
+    "error counter module 5 channel 3",
+    "error counter module 5 channel 4",
+    "error counter module 6 channel 1",
+    "error counter module 6 channel 2",
+    "error counter module 6 channel 3",
+    "error counter module 6 channel 4",
+    "error counter module 7 channel 1",
+    "error counter module 7 channel 2",
+    "error counter module 7 channel 3",
+    "error counter module 7 channel 4",
+    "error counter module 8 channel 1",
+    "error counter module 8 channel 2",
+    "error counter module 8 channel 3",
+    "error counter module 8 channel 4",
+    "error counter module 9 channel 1",
+    "error counter module 9 channel 2",
+    "error counter module 9 channel 3",
+    "error counter module 9 channel 4",
+    "error counter module 10 channel 1",
+    "error counter module 10 channel 2",
+    "error counter module 10 channel 3",
+    "error counter module 10 channel 4",
+    "error counter module 11 channel 1",
+    "error counter module 11 channel 2",
+    "error counter module 11 channel 3",
+    "error counter module 11 channel 4",
+    "error counter module 12 channel 1",
+    "error counter module 12 channel 2",
+    "error counter module 12 channel 3",
+    "error counter module 12 channel 4",
+    "error counter module 13 channel 1",
+    "error counter module 13 channel 2",
+    "error counter module 13 channel 3",
+    "error counter module 13 channel 4",
+    "error counter module 14 channel 1",
+    "error counter module 14 channel 2",
+    "error counter module 14 channel 3",
+    "error counter module 14 channel 4",
+    "error counter module 15 channel 1",
+    "error counter module 15 channel 2",
+    "error counter module 15 channel 3",
+    "error counter module 15 channel 4",
+    "error counter module 16 channel 1",
+    "error counter module 16 channel 2",
+    "error counter module 16 channel 3",
+    "error counter module 16 channel 4",
+    "status function module ps",
+    "total operational runtime msb quint power supply",
+    "total operational runtime lsb quint power supply",
+    "operating time since last restart quint power supply",
+    "temperature in the device quint power supply",
+    "remaining lifetime quint power supply",
+    "soh (state of health) quint power supply",
+    "iol connection status",
+    "input voltage l1 --> l2",
+    "input voltage l2 --> l3",
+    "input voltage l3 --> l1",
+    "input voltage dc quint power supply",
+    "frequency quint power supply",
+    "output voltage quint power supply",
+    "output current quint power supply",
+    "signaling data quint power supply",
+    "minimum output voltage quint power supply",
+    "maximum output voltage quint power supply",
+    "maximum static output current quint power supply",
+    "maximum dynamic output current quint power supply",
+    "minimum temperature (kelvin) quint power supply",
+    "maximum temperature (kelvin) quint power supply",
+    "transient counter quint power supply",
+    "counter for sfb pulses quint power supply",
+    "counter for ovp quint power supply",
+    "counter for device start quint power supply",
+    "counter for dynamic boost pulses quint power supply",
+    "switch on delay between channels",
+    "global nominal current parametrization lock",
+    "local user interface lock",
+    "control channel module 1 channel 1",
+    "control channel module 1 channel 2",
+    "control channel module 1 channel 3",
+    "control channel module 1 channel 4",
+    "control channel module 2 channel 1",
+    "control channel module 2 channel 2",
+    "control channel module 2 channel 3",
+    "control channel module 2 channel 4",
+    "control channel module 3 channel 1",
+    "control channel module 3 channel 2",
+    "control channel module 3 channel 3",
+    "control channel module 3 channel 4",
+    "control channel module 4 channel 1",
+    "control channel module 4 channel 2",
+    "control channel module 4 channel 3",
+    "control channel module 4 channel 4",
+    "control channel module 5 channel 1",
+    "control channel module 5 channel 2",
+    "control channel module 5 channel 3",
+    "control channel module 5 channel 4",
+    "control channel module 6 channel 1",
+    "control channel module 6 channel 2",
+    "control channel module 6 channel 3",
+    "control channel module 6 channel 4",
+    "control channel module 7 channel 1",
+    "control channel module 7 channel 2",
+    "control channel module 7 channel 3",
+    "control channel module 7 channel 4",
+    "control channel module 8 channel 1",
+    "control channel module 8 channel 2",
+    "control channel module 8 channel 3",
+    "control channel module 8 channel 4",
+    "control channel module 9 channel 1",
+    "control channel module 9 channel 2",
+    "control channel module 9 channel 3",
+    "control channel module 9 channel 4",
+    "control channel module 10 channel 1",
+    "control channel module 10 channel 2",
+    "control channel module 10 channel 3",
+    "control channel module 10 channel 4",
+    "control channel module 11 channel 1",
+    "control channel module 11 channel 2",
+    "control channel module 11 channel 3",
+    "control channel module 11 channel 4",
+    "control channel module 12 channel 1",
+    "control channel module 12 channel 2",
+    "control channel module 12 channel 3",
+    "control channel module 12 channel 4",
+    "control channel module 13 channel 1",
+    "control channel module 13 channel 2",
+    "control channel module 13 channel 3",
+    "control channel module 13 channel 4",
+    "control channel module 14 channel 1",
+    "control channel module 14 channel 2",
+    "control channel module 14 channel 3",
+    "control channel module 14 channel 4",
+    "control channel module 15 channel 1",
+    "control channel module 15 channel 2",
+    "control channel module 15 channel 3",
+    "control channel module 15 channel 4",
+    "control channel module 16 channel 1",
+    "control channel module 16 channel 2",
+    "control channel module 16 channel 3",
+    "control channel module 16 channel 4",
+    "nominal current module 1 channel 1",
+    "nominal current module 1 channel 2",
+    "nominal current module 1 channel 3",
+    "nominal current module 1 channel 4",
+    "nominal current module 2 channel 1",
+    "nominal current module 2 channel 2",
+    "nominal current module 2 channel 3",
+    "nominal current module 2 channel 4",
+    "nominal current module 3 channel 1",
+    "nominal current module 3 channel 2",
+    "nominal current module 3 channel 3",
+    "nominal current module 3 channel 4",
+    "nominal current module 4 channel 1",
+    "nominal current module 4 channel 2",
+    "nominal current module 4 channel 3",
+    "nominal current module 4 channel 4",
+    "nominal current module 5 channel 1",
+    "nominal current module 5 channel 2",
+    "nominal current module 5 channel 3",
+    "nominal current module 5 channel 4",
+    "nominal current module 6 channel 1",
+    "nominal current module 6 channel 2",
+    "nominal current module 6 channel 3",
+    "nominal current module 6 channel 4",
+    "nominal current module 7 channel 1",
+    "nominal current module 7 channel 2",
+    "nominal current module 7 channel 3",
+    "nominal current module 7 channel 4",
+    "nominal current module 8 channel 1",
+    "nominal current module 8 channel 2",
+    "nominal current module 8 channel 3",
+    "nominal current module 8 channel 4",
+    "nominal current module 9 channel 1",
+    "nominal current module 9 channel 2",
+    "nominal current module 9 channel 3",
+    "nominal current module 9 channel 4",
+    "nominal current module 10 channel 1",
+    "nominal current module 10 channel 2",
+    "nominal current module 10 channel 3",
+    "nominal current module 10 channel 4",
+    "nominal current module 11 channel 1",
+    "nominal current module 11 channel 2",
+    "nominal current module 11 channel 3",
+    "nominal current module 11 channel 4",
+    "nominal current module 12 channel 1",
+    "nominal current module 12 channel 2",
+    "nominal current module 12 channel 3",
+    "nominal current module 12 channel 4",
+    "nominal current module 13 channel 1",
+    "nominal current module 13 channel 2",
+    "nominal current module 13 channel 3",
+    "nominal current module 13 channel 4",
+    "nominal current module 14 channel 1",
+    "nominal current module 14 channel 2",
+    "nominal current module 14 channel 3",
+    "nominal current module 14 channel 4",
+    "nominal current module 15 channel 1",
+    "nominal current module 15 channel 2",
+    "nominal current module 15 channel 3",
+    "nominal current module 15 channel 4",
+    "nominal current module 16 channel 1",
+    "nominal current module 16 channel 2",
+    "nominal current module 16 channel 3",
+    "nominal current module 16 channel 4",
+    "nominal current parametrization lock module 1 channel 1",
+    "nominal current parametrization lock module 1 channel 2",
+    "nominal current parametrization lock module 1 channel 3",
+    "nominal current parametrization lock module 1 channel 4",
+    "nominal current parametrization lock module 2 channel 1",
+    "nominal current parametrization lock module 2 channel 2",
+    "nominal current parametrization lock module 2 channel 3",
+    "nominal current parametrization lock module 2 channel 4",
+    "nominal current parametrization lock module 3 channel 1",
+    "nominal current parametrization lock module 3 channel 2",
+    "nominal current parametrization lock module 3 channel 3",
+    "nominal current parametrization lock module 3 channel 4",
+    "nominal current parametrization lock module 4 channel 1",
+    "nominal current parametrization lock module 4 channel 2",
+    "nominal current parametrization lock module 4 channel 3",
+    "nominal current parametrization lock module 4 channel 4",
+    "nominal current parametrization lock module 5 channel 1",
+    "nominal current parametrization lock module 5 channel 2",
+    "nominal current parametrization lock module 5 channel 3",
+    "nominal current parametrization lock module 5 channel 4",
+    "nominal current parametrization lock module 6 channel 1",
+    "nominal current parametrization lock module 6 channel 2",
+    "nominal current parametrization lock module 6 channel 3",
+    "nominal current parametrization lock module 6 channel 4",
+    "nominal current parametrization lock module 7 channel 1",
+    "nominal current parametrization lock module 7 channel 2",
+    "nominal current parametrization lock module 7 channel 3",
+    "nominal current parametrization lock module 7 channel 4",
+    "nominal current parametrization lock module 8 channel 1",
+    "nominal current parametrization lock module 8 channel 2",
+    "nominal current parametrization lock module 8 channel 3",
+    "nominal current parametrization lock module 8 channel 4",
+    "nominal current parametrization lock module 9 channel 1",
+    "nominal current parametrization lock module 9 channel 2",
+    "nominal current parametrization lock module 9 channel 3",
+    "nominal current parametrization lock module 9 channel 4",
+    "nominal current parametrization lock module 10 channel 1",
+    "nominal current parametrization lock module 10 channel 2",
+    "nominal current parametrization lock module 10 channel 3",
+    "nominal current parametrization lock module 10 channel 4",
+    "nominal current parametrization lock module 11 channel 1",
+    "nominal current parametrization lock module 11 channel 2",
+    "nominal current parametrization lock module 11 channel 3",
+    "nominal current parametrization lock module 11 channel 4",
+    "nominal current parametrization lock module 12 channel 1",
+    "nominal current parametrization lock module 12 channel 2",
+    "nominal current parametrization lock module 12 channel 3",
+    "nominal current parametrization lock module 12 channel 4",
+    "nominal current parametrization lock module 13 channel 1",
+    "nominal current parametrization lock module 13 channel 2",
+    "nominal current parametrization lock module 13 channel 3",
+    "nominal current parametrization lock module 13 channel 4",
+    "nominal current parametrization lock module 14 channel 1",
+    "nominal current parametrization lock module 14 channel 2",
+    "nominal current parametrization lock module 14 channel 3",
+    "nominal current parametrization lock module 14 channel 4",
+    "nominal current parametrization lock module 15 channel 1",
+    "nominal current parametrization lock module 15 channel 2",
+    "nominal current parametrization lock module 15 channel 3",
+    "nominal current parametrization lock module 15 channel 4",
+    "nominal current parametrization lock module 16 channel 1",
+    "nominal current parametrization lock module 16 channel 2",
+    "nominal current parametrization lock module 16 channel 3",
+    "nominal current parametrization lock module 16 channel 4",
+    "output voltage quint power supply",
+    "parameters settings quint power supply",
+    "output characteristic quint power supply",
+    "tripping current fuse mode quint power supply",
+    "tripping time fuse mode and secure shut-off quint power supply",
+    "secure shut-off tripping voltage quint power supply",
+    "configuration of the group message for relay contact 13/14 quint power supply",
+    "threshold value for output voltage quint power supply",
+    "threshold value for output power quint power supply",
+    "sthreshold value for operating time quint power supply",
+    "threshold value for remaining lifetime quint power supply",
+};
+
+constexpr const char* register_descriptions_lower[] = {
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "reset at value >0",
+    "\"caparoc pm mb\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"caparoc e...\"",
+    "\"quint power supply\"",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "bit0: undervoltage; bit1: overvoltage; bit2: cummulativechannelerror; bit3: cummulative 80% warning; bit4: systemcurrenttoohigh;",
+    "[]=a",
+    "[]=v",
+    " ",
+    " ",
+    "[]=a",
+    "[]=ms",
+    "[]=ms",
+    "[]=h",
+    "[]=°c",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "bit0: 80%warning; bit1: overload; bit2: shortcircuit; bit3: hardwareerror; bit4: voltageerror; bit5: modulecurrenttoohigh; bit6: systemcurrenttoohigh",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "[]=ma, resolution 100ma",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "0…255",
+    "bit 0: status of output voltage (dc ok); bit 1: status of output power ; bit 2: status of operational runtime; bit 3: status of early warning of high temperature; bit 4: reserverd; bit 5: status of voltage limitation; bit 6:  status of phase monitoring; bit 7: status of service life monitoring ; bit 8..10 operation mode ; bit 11,12: phase sequence ; bit 13: ac/dc detection of input voltage",
+    "[]=0,1h",
+    "[]=0,1h",
+    "[]=0,1h",
+    "[]=k",
+    "[]=d",
+    "[]=0,01%",
+    "0: iol connected, 1: iol not connected",
+    "[]=v",
+    "[]=v",
+    "[]=v",
+    "[]=v",
+    "[]=hz",
+    "[]= 0,01 v",
+    "[]= 0,01 a",
+    "bit 0: status relais false: closed true: open  bit 1-2: stat. led1 (dc ok) 0b00: off  0b01: on  0b10: blinking  0b11: future use bit 3-4: stat. led2 (>50%) 0b00: off  0b01: on  0b10: blinking  0b11: future use bit 5-6: stat. led3 (>75%) 0b00: off  0b01: on  0b10: blinking  0b11: future use bit 7-8: stat. led4 (>100%) 0b00: off  0b01: on  0b10: blinking  0b11: future use bit 9-10: stat. led5 (io-link) 0b00: off  0b01: on  0b10: blinking  0b11: future use bit 11-15: reserved (0)",
+    "[]= 0,01 v",
+    "[]= 0,01 v",
+    "[]= 0,01 v",
+    "[]= 0,01 v",
+    "[]=k",
+    "[]=k",
+    " ",
+    " ",
+    " ",
+    " ",
+    " ",
+    "0...10000ms",
+    " ",
+    " ",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "0: off; 1: on",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "[]=a",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "0: unlocked; 1: locked",
+    "2390 ... 2960 [0,01*v], default: 2410",
+    "bit 0: parallelmode  0: parallelmode inactive 1: parallelmode active bit 1: button lock 0: unlocked 1: locked bit 2: factory settings 0: no reset 1: reset to factory",
+    "bit0: sfb bit1: db bit2: sb bit3: reserved bit4…6: 1: ui advanced (0bx001xxxx) 2: fusemode current (0bx010xxxx) 3: secure shut off / fusemode voltage (0bx011xxxx) 4: smart hiccup (0bx100xxxx) bit7: reserved",
+    "25...125 [1 %], default 100",
+    "1...1200 [0,01 s], default 1",
+    "40...90 [1 %], default 75",
+    "\"bit 0: relay 13/14: enable output voltage (dc ok) 0: disale 1: enable\" \"bit 1: relay 13/14: enable output current (p<pnenn) 0: disale 1: enable\" \"bit 2: relay 13/14: enable operating hours  0: disale 1: enable\" \"bit 3: relay 13/14: enable temperature ok 0: disale 1: enable\" \"bit 4: relay 13/14: enable input voltage ok 0: disale 1: enable\" \"bit 5: relay 13/14: enable overvoltage protection activated 0: disale 1: enable\" \"bit 6: relay 13/14: enable phase monitoring (2ac/3ac) 0: disale 1: enable\" \"bit 7: relay 13/14: enable remaininglifetime 0: disale 1: enable\" \"bit 8: phasesequence 0: disable 1: enable\" bit 15: relay 13/14: invert total default: 0x0001 (volt.err)",
+    "25...135 [1 %], default: 90",
+    "5...200 [1 %], default: 100",
+    "0...65535 [1 d], default: 3650",
+    "0...5475 [1 d], default: 0",
+};
+
+// Alphanumeric token of a lowercase name or description and the registers containing it
+struct RegisterToken {
+    const char* text;
+    uint16_t first;  // first entry in register_token_postings
+    uint16_t count;  // number of registers
+};
+
+// Tokens sorted by text
+constexpr RegisterToken register_tokens[] = {
+    {"0", 0, 313},
+    {"01", 313, 9},
+    {"0b00", 322, 1},
+    {"0b01", 323, 1},
+    {"0b10", 324, 1},
+    {"0b11", 325, 1},
+    {"0bx001xxxx", 326, 1},
+    {"0bx010xxxx", 327, 1},
+    {"0bx011xxxx", 328, 1},
+    {"0bx100xxxx", 329, 1},
+    {"0x0001", 330, 1},
+    {"1", 331, 282},
+    {"10", 613, 46},
+    {"100", 659, 3},
+    {"10000ms", 662, 1},
+    {"100ma", 663, 64},
+    {"11", 727, 46},
+    {"12", 773, 45},
+    {"1200", 818, 1},
+    {"125", 819, 1},
+    {"13", 820, 46},
+    {"135", 866, 1},
+    {"14", 867, 45},
+    {"15", 912, 46},
+    {"16", 958, 44},
+    {"1h", 1002, 3},
+    {"2", 1005, 184},
+    {"200", 1189, 1},
+    {"2390", 1190, 1},
+    {"2410", 1191, 1},
+    {"25", 1192, 2},
+    {"255", 1194, 64},
+    {"2960", 1258, 1},
+    {"2ac", 1259, 1},
+    {"3", 1260, 183},
+    {"3650", 1443, 1},
+    {"3ac", 1444, 1},
+    {"4", 1445, 183},
+    {"40", 1628, 1},
+    {"5", 1629, 48},
+    {"50", 1677, 1},
+    {"5475", 1678, 1},
+    {"6", 1679, 48},
+    {"65535", 1727, 1},
+    {"7", 1728, 47},
+    {"75", 1775, 2},
+    {"8", 1777, 47},
+    {"80", 1824, 65},
+    {"9", 1889, 45},
+    {"90", 1934, 2},
+    {"a", 1936, 195},
+    {"ac", 2131, 1},
+    {"activated", 2132, 1},
+    {"active", 2133, 1},
+    {"advanced", 2134, 1},
+    {"all", 2135, 35},
+    {"and", 2170, 2},
+    {"application", 2172, 18},
+    {"at", 2190, 102},
+    {"between", 2292, 1},
+    {"bit", 2293, 4},
+    {"bit0", 2297, 66},
+    {"bit1", 2363, 66},
+    {"bit2", 2429, 66},
+    {"bit3", 2495, 66},
+    {"bit4", 2561, 66},
+    {"bit5", 2627, 64},
+    {"bit6", 2691, 64},
+    {"bit7", 2755, 1},
+    {"blinking", 2756, 1},
+    {"boost", 2757, 1},
+    {"boot", 2758, 2},
+    {"breaker", 2760, 3},
+    {"bus", 2763, 2},
+    {"button", 2765, 1},
+    {"byte", 2766, 1},
+    {"c", 2767, 1},
+    {"caparoc", 2768, 18},
+    {"channel", 2786, 593},
+    {"channels", 3379, 49},
+    {"characteristic", 3428, 1},
+    {"circuit", 3429, 3},
+    {"closed", 3432, 1},
+    {"configuration", 3433, 1},
+    {"connected", 3434, 4},
+    {"connection", 3438, 1},
+    {"contact", 3439, 1},
+    {"control", 3440, 64},
+    {"counter", 3504, 134},
+    {"cummulative", 3638, 1},
+    {"cummulativechannelerror", 3639, 1},
+    {"current", 3640, 328},
+    {"currently", 3968, 2},
+    {"currents", 3970, 1},
+    {"cycle", 3971, 2},
+    {"d", 3973, 3},
+    {"data", 3976, 1},
+    {"db", 3977, 1},
+    {"dc", 3978, 4},
+    {"default", 3982, 27},
+    {"delay", 4009, 1},
+    {"detection", 4010, 1},
+    {"device", 4011, 2},
+    {"disable", 4013, 1},
+    {"disale", 4014, 1},
+    {"dynamic", 4015, 2},
+    {"e", 4017, 16},
+    {"early", 4033, 1},
+    {"enable", 4034, 1},
+    {"err", 4035, 1},
+    {"error", 4036, 146},
+    {"factory", 4182, 1},
+    {"false", 4183, 1},
+    {"firmware", 4184, 18},
+    {"for", 4202, 9},
+    {"frequency", 4211, 1},
+    {"function", 4212, 1},
+    {"fuse", 4213, 2},
+    {"fusemode", 4215, 1},
+    {"future", 4216, 1},
+    {"global", 4217, 3},
+    {"group", 4220, 1},
+    {"h", 4221, 1},
+    {"hardware", 4222, 18},
+    {"hardwareerror", 4240, 64},
+    {"health", 4304, 1},
+    {"hiccup", 4305, 1},
+    {"high", 4306, 1},
+    {"hours", 4307, 2},
+    {"hz", 4309, 1},
+    {"id", 4310, 2},
+    {"in", 4312, 1},
+    {"inactive", 4313, 1},
+    {"input", 4314, 7},
+    {"interface", 4321, 1},
+    {"internal", 4322, 1},
+    {"invert", 4323, 1},
+    {"io", 4324, 1},
+    {"iol", 4325, 1},
+    {"k", 4326, 3},
+    {"kelvin", 4329, 2},
+    {"l1", 4331, 2},
+    {"l2", 4333, 2},
+    {"l3", 4335, 2},
+    {"last", 4337, 2},
+    {"led1", 4339, 1},
+    {"led2", 4340, 1},
+    {"led3", 4341, 1},
+    {"led4", 4342, 1},
+    {"led5", 4343, 1},
+    {"life", 4344, 1},
+    {"lifetime", 4345, 2},
+    {"limitation", 4347, 1},
+    {"link", 4348, 1},
+    {"load", 4349, 64},
+    {"local", 4413, 1},
+    {"lock", 4414, 67},
+    {"locked", 4481, 65},
+    {"lsb", 4546, 1},
+    {"ma", 4547, 64},
+    {"max", 4611, 2},
+    {"maximal", 4613, 64},
+    {"maximum", 4677, 4},
+    {"mb", 4681, 1},
+    {"message", 4682, 1},
+    {"minimal", 4683, 64},
+    {"minimum", 4747, 2},
+    {"mode", 4749, 3},
+    {"module", 4752, 711},
+    {"modulecurrenttoohigh", 5463, 64},
+    {"modules", 5527, 6},
+    {"monitoring", 5533, 2},
+    {"ms", 5535, 2},
+    {"msb", 5537, 1},
+    {"name", 5538, 18},
+    {"no", 5556, 36},
+    {"nominal", 5592, 258},
+    {"not", 5850, 1},
+    {"number", 5851, 18},
+    {"of", 5869, 23},
+    {"off", 5892, 68},
+    {"ok", 5960, 3},
+    {"on", 5963, 66},
+    {"open", 6029, 1},
+    {"operating", 6030, 3},
+    {"operation", 6033, 1},
+    {"operational", 6034, 3},
+    {"order", 6037, 16},
+    {"output", 6053, 12},
+    {"overload", 6065, 64},
+    {"overvoltage", 6129, 2},
+    {"ovp", 6131, 1},
+    {"p", 6132, 1},
+    {"parallelmode", 6133, 1},
+    {"parameters", 6134, 19},
+    {"parametrization", 6153, 65},
+    {"phase", 6218, 2},
+    {"phasesequence", 6220, 1},
+    {"pm", 6221, 1},
+    {"pnenn", 6222, 1},
+    {"power", 6223, 48},
+    {"product", 6271, 20},
+    {"protection", 6291, 1},
+    {"ps", 6292, 1},
+    {"pulses", 6293, 2},
+    {"quint", 6295, 41},
+    {"relais", 6336, 1},
+    {"relay", 6337, 1},
+    {"remaining", 6338, 2},
+    {"remaininglifetime", 6340, 1},
+    {"reserved", 6341, 2},
+    {"reserverd", 6343, 1},
+    {"reset", 6344, 102},
+    {"resetting", 6446, 18},
+    {"resolution", 6464, 64},
+    {"restart", 6528, 1},
+    {"revision", 6529, 1},
+    {"runtime", 6530, 3},
+    {"s", 6533, 1},
+    {"sb", 6534, 1},
+    {"secure", 6535, 3},
+    {"sequence", 6538, 1},
+    {"serial", 6539, 18},
+    {"service", 6557, 1},
+    {"settings", 6558, 19},
+    {"sfb", 6577, 2},
+    {"shortcircuit", 6579, 64},
+    {"shut", 6643, 3},
+    {"signaling", 6646, 1},
+    {"since", 6647, 2},
+    {"smart", 6649, 1},
+    {"soh", 6650, 1},
+    {"start", 6651, 1},
+    {"stat", 6652, 1},
+    {"state", 6653, 1},
+    {"static", 6654, 1},
+    {"statistics", 6655, 1},
+    {"status", 6656, 68},
+    {"sthreshold", 6724, 1},
+    {"sum", 6725, 1},
+    {"supply", 6726, 40},
+    {"switch", 6766, 1},
+    {"system", 6767, 1},
+    {"systemcurrenttoohigh", 6768, 65},
+    {"temperature", 6833, 6},
+    {"the", 6839, 20},
+    {"threshold", 6859, 3},
+    {"time", 6862, 3},
+    {"to", 6865, 19},
+    {"total", 6884, 4},
+    {"transient", 6888, 1},
+    {"tripping", 6889, 3},
+    {"true", 6892, 1},
+    {"ui", 6893, 1},
+    {"undervoltage", 6894, 1},
+    {"unlocked", 6895, 65},
+    {"use", 6960, 1},
+    {"user", 6961, 1},
+    {"v", 6962, 11},
+    {"value", 6973, 105},
+    {"version", 7078, 35},
+    {"volt", 7113, 1},
+    {"voltage", 7114, 14},
+    {"voltageerror", 7128, 64},
+    {"warning", 7192, 66},
+};
+constexpr size_t register_token_count = 265;
+
+// register_table indices per token, ascending
+constexpr uint16_t register_token_postings[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+    485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+    501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516,
+    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+    533, 534, 535, 536, 537, 538, 539, 540, 541, 544, 545, 551, 552, 553, 554, 555,
+    556, 557, 565, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+    581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596,
+    597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+    613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628,
+    629, 630, 631, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724,
+    725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740,
+    741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756,
+    757, 758, 759, 760, 761, 764, 766, 769, 770, 544, 551, 552, 554, 555, 556, 557,
+    760, 764, 553, 553, 553, 553, 762, 762, 762, 762, 766, 5, 21, 37, 38, 39,
+    40, 41, 45, 49, 53, 57, 61, 65, 69, 73, 77, 81, 85, 89, 93, 97,
+    102, 120, 138, 156, 174, 192, 208, 209, 210, 211, 212, 216, 220, 224, 228, 232,
+    236, 240, 244, 248, 252, 256, 260, 264, 268, 272, 273, 274, 275, 276, 280, 284,
+    288, 292, 296, 300, 304, 308, 312, 316, 320, 324, 328, 332, 346, 347, 348, 349,
+    350, 354, 358, 362, 366, 370, 374, 378, 382, 386, 390, 394, 398, 402, 406, 410,
+    411, 412, 413, 414, 418, 422, 426, 430, 434, 438, 442, 446, 450, 454, 458, 462,
+    466, 470, 474, 475, 476, 477, 478, 482, 486, 490, 494, 498, 502, 506, 510, 514,
+    518, 522, 526, 530, 534, 538, 545, 553, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 640, 644, 648,
+    652, 656, 660, 664, 668, 672, 676, 680, 684, 688, 692, 696, 697, 698, 699, 700,
+    701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716,
+    717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732,
+    733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748,
+    749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 761, 762, 763, 764, 765,
+    766, 767, 768, 769, 770, 14, 30, 73, 74, 75, 76, 111, 129, 147, 165, 183,
+    201, 244, 245, 246, 247, 308, 309, 310, 311, 382, 383, 384, 385, 446, 447, 448,
+    449, 510, 511, 512, 513, 538, 553, 604, 605, 606, 607, 668, 669, 670, 671, 732,
+    733, 734, 735, 553, 763, 768, 565, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+    419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+    435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+    451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+    467, 468, 469, 470, 471, 472, 473, 15, 31, 77, 78, 79, 80, 112, 130, 148,
+    166, 184, 202, 248, 249, 250, 251, 312, 313, 314, 315, 386, 387, 388, 389, 450,
+    451, 452, 453, 514, 515, 516, 517, 538, 553, 608, 609, 610, 611, 672, 673, 674,
+    675, 736, 737, 738, 739, 16, 32, 81, 82, 83, 84, 113, 131, 149, 167, 185,
+    203, 252, 253, 254, 255, 316, 317, 318, 319, 390, 391, 392, 393, 454, 455, 456,
+    457, 518, 519, 520, 521, 538, 612, 613, 614, 615, 676, 677, 678, 679, 740, 741,
+    742, 743, 764, 763, 17, 33, 85, 86, 87, 88, 114, 132, 150, 168, 186, 204,
+    256, 257, 258, 259, 320, 321, 322, 323, 394, 395, 396, 397, 458, 459, 460, 461,
+    522, 523, 524, 525, 538, 616, 617, 618, 619, 680, 681, 682, 683, 744, 745, 746,
+    747, 766, 767, 18, 34, 89, 90, 91, 92, 115, 133, 151, 169, 187, 205, 260,
+    261, 262, 263, 324, 325, 326, 327, 398, 399, 400, 401, 462, 463, 464, 465, 526,
+    527, 528, 529, 620, 621, 622, 623, 684, 685, 686, 687, 748, 749, 750, 751, 766,
+    19, 35, 93, 94, 95, 96, 116, 134, 152, 170, 188, 206, 264, 265, 266, 267,
+    328, 329, 330, 331, 402, 403, 404, 405, 466, 467, 468, 469, 530, 531, 532, 533,
+    553, 624, 625, 626, 627, 688, 689, 690, 691, 752, 753, 754, 755, 766, 20, 36,
+    97, 98, 99, 100, 117, 135, 153, 171, 189, 207, 268, 269, 270, 271, 332, 333,
+    334, 335, 406, 407, 408, 409, 470, 471, 472, 473, 534, 535, 536, 537, 628, 629,
+    630, 631, 692, 693, 694, 695, 756, 757, 758, 759, 539, 540, 541, 6, 22, 38,
+    41, 42, 43, 44, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90,
+    94, 98, 103, 121, 139, 157, 175, 193, 209, 212, 213, 214, 215, 217, 221, 225,
+    229, 233, 237, 241, 245, 249, 253, 257, 261, 265, 269, 273, 276, 277, 278, 279,
+    281, 285, 289, 293, 297, 301, 305, 309, 313, 317, 321, 325, 329, 333, 347, 350,
+    351, 352, 353, 355, 359, 363, 367, 371, 375, 379, 383, 387, 391, 395, 399, 403,
+    407, 411, 414, 415, 416, 417, 419, 423, 427, 431, 435, 439, 443, 447, 451, 455,
+    459, 463, 467, 471, 475, 478, 479, 480, 481, 483, 487, 491, 495, 499, 503, 507,
+    511, 515, 519, 523, 527, 531, 535, 538, 553, 569, 572, 573, 574, 575, 577, 581,
+    585, 589, 593, 597, 601, 605, 609, 613, 617, 621, 625, 629, 633, 636, 637, 638,
+    639, 641, 645, 649, 653, 657, 661, 665, 669, 673, 677, 681, 685, 689, 693, 697,
+    700, 701, 702, 703, 705, 709, 713, 717, 721, 725, 729, 733, 737, 741, 745, 749,
+    753, 757, 761, 762, 766, 768, 760, 760, 763, 767, 474, 475, 476, 477, 478, 479,
+    480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 760, 766, 7, 23, 39, 43,
+    45, 46, 47, 48, 51, 55, 59, 63, 67, 71, 75, 79, 83, 87, 91, 95,
+    99, 104, 122, 140, 158, 176, 194, 210, 214, 216, 217, 218, 219, 222, 226, 230,
+    234, 238, 242, 246, 250, 254, 258, 262, 266, 270, 274, 278, 280, 281, 282, 283,
+    286, 290, 294, 298, 302, 306, 310, 314, 318, 322, 326, 330, 334, 348, 352, 354,
+    355, 356, 357, 360, 364, 368, 372, 376, 380, 384, 388, 392, 396, 400, 404, 408,
+    412, 416, 418, 419, 420, 421, 424, 428, 432, 436, 440, 444, 448, 452, 456, 460,
+    464, 468, 472, 476, 480, 482, 483, 484, 485, 488, 492, 496, 500, 504, 508, 512,
+    516, 520, 524, 528, 532, 536, 538, 553, 570, 574, 576, 577, 578, 579, 582, 586,
+    590, 594, 598, 602, 606, 610, 614, 618, 622, 626, 630, 634, 638, 640, 641, 642,
+    643, 646, 650, 654, 658, 662, 666, 670, 674, 678, 682, 686, 690, 694, 698, 702,
+    704, 705, 706, 707, 710, 714, 718, 722, 726, 730, 734, 738, 742, 746, 750, 754,
+    758, 762, 766, 769, 766, 8, 24, 40, 44, 48, 49, 50, 51, 52, 56, 60,
+    64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 105, 123, 141, 159, 177, 195,
+    211, 215, 219, 220, 221, 222, 223, 227, 231, 235, 239, 243, 247, 251, 255, 259,
+    263, 267, 271, 275, 279, 283, 284, 285, 286, 287, 291, 295, 299, 303, 307, 311,
+    315, 319, 323, 327, 331, 335, 349, 353, 357, 358, 359, 360, 361, 365, 369, 373,
+    377, 381, 385, 389, 393, 397, 401, 405, 409, 413, 417, 421, 422, 423, 424, 425,
+    429, 433, 437, 441, 445, 449, 453, 457, 461, 465, 469, 473, 477, 481, 485, 486,
+    487, 488, 489, 493, 497, 501, 505, 509, 513, 517, 521, 525, 529, 533, 537, 538,
+    553, 571, 575, 579, 580, 581, 582, 583, 587, 591, 595, 599, 603, 607, 611, 615,
+    619, 623, 627, 631, 635, 639, 643, 644, 645, 646, 647, 651, 655, 659, 663, 667,
+    671, 675, 679, 683, 687, 691, 695, 699, 703, 707, 708, 709, 710, 711, 715, 719,
+    723, 727, 731, 735, 739, 743, 747, 751, 755, 759, 762, 766, 765, 9, 25, 53,
+    54, 55, 56, 106, 124, 142, 160, 178, 196, 224, 225, 226, 227, 288, 289, 290,
+    291, 362, 363, 364, 365, 426, 427, 428, 429, 490, 491, 492, 493, 538, 553, 584,
+    585, 586, 587, 648, 649, 650, 651, 712, 713, 714, 715, 766, 768, 553, 770, 10,
+    26, 57, 58, 59, 60, 107, 125, 143, 161, 179, 197, 228, 229, 230, 231, 292,
+    293, 294, 295, 366, 367, 368, 369, 430, 431, 432, 433, 494, 495, 496, 497, 538,
+    553, 588, 589, 590, 591, 652, 653, 654, 655, 716, 717, 718, 719, 762, 766, 769,
+    11, 27, 61, 62, 63, 64, 108, 126, 144, 162, 180, 198, 232, 233, 234, 235,
+    296, 297, 298, 299, 370, 371, 372, 373, 434, 435, 436, 437, 498, 499, 500, 501,
+    538, 553, 592, 593, 594, 595, 656, 657, 658, 659, 720, 721, 722, 723, 766, 553,
+    765, 12, 28, 65, 66, 67, 68, 109, 127, 145, 163, 181, 199, 236, 237, 238,
+    239, 300, 301, 302, 303, 374, 375, 376, 377, 438, 439, 440, 441, 502, 503, 504,
+    505, 538, 553, 596, 597, 598, 599, 660, 661, 662, 663, 724, 725, 726, 727, 766,
+    336, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+    409, 13, 29, 69, 70, 71, 72, 110, 128, 146, 164, 182, 200, 240, 241, 242,
+    243, 304, 305, 306, 307, 378, 379, 380, 381, 442, 443, 444, 445, 506, 507, 508,
+    509, 553, 600, 601, 602, 603, 664, 665, 666, 667, 728, 729, 730, 731, 765, 767,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    337, 341, 552, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+    645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+    661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+    677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+    693, 694, 695, 538, 766, 761, 762, 0, 1, 2, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 0, 764, 0, 3, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 340, 565, 538, 553, 761, 766, 336, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 762, 336, 346, 347, 348, 349,
+    350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381,
+    382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+    398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 762, 336, 346, 347,
+    348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+    364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+    380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+    396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 762, 336,
+    346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361,
+    362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393,
+    394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+    762, 336, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
+    360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
+    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
+    392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
+    408, 409, 762, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+    407, 408, 409, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+    407, 408, 409, 762, 553, 564, 340, 344, 0, 1, 2, 342, 343, 761, 336, 345,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 342, 1, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+    221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+    237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+    253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+    285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+    301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+    317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+    333, 334, 335, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+    407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+    423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+    439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+    455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+    471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+    487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+    503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
+    519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+    535, 536, 537, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+    581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596,
+    597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+    613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628,
+    629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+    645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+    661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+    677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+    693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724,
+    725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740,
+    741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756,
+    757, 758, 759, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 207, 565, 762, 0, 1, 2, 553, 766, 191, 339, 340, 545, 545, 766,
+    568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583,
+    584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
+    600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615,
+    616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631,
+    2, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+    489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+    505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+    537, 560, 561, 562, 563, 564, 336, 336, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+    312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 335, 337, 410, 411, 412, 413, 414, 415, 416,
+    417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
+    433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+    449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+    465, 466, 467, 468, 469, 470, 471, 472, 473, 552, 556, 557, 566, 632, 633, 634,
+    635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650,
+    651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+    667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682,
+    683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698,
+    699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714,
+    715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730,
+    731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746,
+    747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 762, 763, 766,
+    191, 339, 341, 342, 343, 543, 769, 770, 553, 762, 538, 549, 553, 766, 0, 3,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    760, 763, 764, 765, 766, 767, 768, 769, 770, 565, 538, 542, 563, 766, 766, 557,
+    564, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 538, 766, 766, 1, 2, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+    79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 96, 97, 98, 99, 100, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 761, 553, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 561, 562, 563, 564, 766, 767,
+    768, 769, 770, 550, 538, 763, 764, 762, 553, 1, 336, 566, 766, 344, 155, 156,
+    157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+    346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361,
+    362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393,
+    394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+    544, 762, 538, 344, 766, 550, 119, 136, 542, 761, 338, 538, 546, 547, 548, 549,
+    766, 567, 345, 766, 553, 545, 542, 558, 559, 558, 559, 546, 548, 546, 547, 547,
+    548, 344, 541, 553, 553, 553, 553, 553, 538, 543, 770, 538, 553, 410, 411, 412,
+    413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+    429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+    445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460,
+    461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 567, 566, 567,
+    696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+    712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+    728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743,
+    744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759,
+    761, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710,
+    711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726,
+    727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742,
+    743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758,
+    759, 761, 540, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+    423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+    439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+    455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+    471, 472, 473, 342, 343, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282,
+    283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
+    299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+    315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+    331, 332, 333, 334, 335, 555, 556, 557, 559, 101, 766, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 554, 558, 538, 763, 764,
+    0, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+    150, 151, 152, 153, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+    167, 168, 169, 170, 171, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+    202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+    218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+    234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+    250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265,
+    266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281,
+    282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297,
+    298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313,
+    314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329,
+    330, 331, 332, 333, 334, 335, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+    356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+    372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+    388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403,
+    404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+    420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+    436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
+    452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+    577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592,
+    593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608,
+    609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624,
+    625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640,
+    641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656,
+    657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672,
+    673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688,
+    689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704,
+    705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720,
+    721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736,
+    737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752,
+    753, 754, 755, 756, 757, 758, 759, 346, 347, 348, 349, 350, 351, 352, 353, 354,
+    355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370,
+    371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 0, 1, 2, 191, 339, 340, 538, 766, 342,
+    343, 539, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+    203, 204, 205, 206, 207, 339, 340, 761, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+    312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 335, 341, 566, 632, 633, 634, 635, 636, 637,
+    638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653,
+    654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669,
+    670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685,
+    686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701,
+    702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+    718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+    734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
+    750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 545, 137, 138, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 339, 340,
+    341, 538, 544, 766, 553, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578,
+    579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594,
+    595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610,
+    611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626,
+    627, 628, 629, 630, 631, 762, 764, 765, 538, 553, 766, 553, 565, 568, 569, 570,
+    571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+    587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602,
+    603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618,
+    619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 553, 541, 766,
+    769, 538, 538, 539, 540, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+    131, 132, 133, 134, 135, 538, 551, 552, 554, 555, 556, 557, 760, 762, 766, 767,
+    768, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+    409, 336, 766, 562, 766, 761, 0, 3, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 761, 566, 696, 697, 698, 699, 700, 701,
+    702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+    718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+    734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749,
+    750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 538, 766, 766, 101, 766, 0,
+    3, 4, 101, 118, 119, 136, 137, 154, 155, 172, 173, 190, 343, 538, 539, 540,
+    541, 542, 543, 544, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560,
+    561, 562, 563, 564, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 101,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 136, 766, 538, 561, 564, 3, 4, 118, 136, 154, 172, 190, 343, 539,
+    540, 541, 542, 543, 544, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770,
+    553, 766, 543, 770, 766, 553, 762, 538, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 761, 0, 3,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+    426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
+    442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+    458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473,
+    541, 173, 538, 539, 540, 764, 762, 762, 764, 765, 538, 137, 138, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 538, 0, 3,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    761, 561, 762, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+    391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+    407, 408, 409, 762, 764, 765, 553, 344, 541, 762, 544, 563, 553, 544, 556, 4,
+    336, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+    409, 538, 545, 553, 769, 341, 3, 4, 118, 136, 154, 172, 190, 539, 540, 541,
+    542, 543, 544, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 565, 337,
+    336, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+    409, 345, 538, 542, 558, 559, 766, 0, 3, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 542, 766, 767, 768, 770, 541, 764,
+    769, 0, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 761, 337, 539, 540, 766, 560, 763, 764, 765, 553, 762, 336, 696,
+    697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712,
+    713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728,
+    729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744,
+    745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 761,
+    553, 567, 338, 546, 547, 548, 549, 551, 554, 555, 556, 557, 760, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
+    99, 100, 767, 768, 769, 770, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 174, 175, 176, 177, 178, 179, 180, 181,
+    182, 183, 184, 185, 186, 187, 188, 189, 190, 766, 338, 538, 546, 547, 548, 549,
+    551, 554, 555, 760, 762, 765, 766, 767, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 336, 346, 347, 348, 349, 350, 351, 352,
+    353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368,
+    369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384,
+    385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400,
+    401, 402, 403, 404, 405, 406, 407, 408, 409, 538,
+};
+
 } // namespace v1
 } // namespace caparoc
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include "caparoc/caparoc.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Resilient Session
+// ============================================================================
+
+/**
+ * @brief Options for ResilientSession
+ */
+struct ResilientSessionOptions {
+    /// Wait before the first reconnect attempt
+    std::chrono::milliseconds initial_backoff{500};
+
+    /// Upper bound for the wait between reconnect attempts
+    std::chrono::milliseconds max_backoff{30000};
+
+    /// Growth of the wait after each failed attempt
+    double backoff_multiplier = 2.0;
+
+    /// Fraction of the wait that is randomised (0: none, 1: anywhere between zero and the wait)
+    double jitter = 0.2;
+
+    /// Consecutive failed operations after which the connection is considered broken
+    unsigned failures_before_reconnect = 2;
+};
+
+/**
+ * @brief Outcome of validating the cached device state after a connect
+ */
+enum class Revalidation {
+    initial,           // first connection, inventory read
+    unchanged,         // same boot and module count, cached topology and inventory kept
+    rebooted,          // the device rebooted, topology and inventory re-read
+    topology_changed   // the module count changed, topology and inventory re-read
+};
+
+/**
+ * @brief Boot identity of a device (0x6003-0x6008)
+ */
+struct BootIdentity {
+    uint16_t connected_modules;           // 0x6003, mirrors 0x2000
+    uint16_t connected_modules_at_boot;   // 0x6004
+    uint16_t hours_since_last_boot;       // 0x6008
+};
+
+/**
+ * @brief Read the boot identity in one transaction (0x6003-0x6008)
+ *
+ * @param conn MODBUS connection
+ * @return std::optional<BootIdentity> Identity if successful
+ */
+std::optional<BootIdentity> read_boot_identity(libmodbus_cpp::ModbusConnection& conn);
+
+/**
+ * @brief Connection that reconnects with exponential backoff and keeps topology and inventory across reconnects
+ *
+ * Operations run through execute(). While the connection is down, execute() returns
+ * the failure value of the operation without blocking and a reconnect is attempted
+ * once the backoff has elapsed. The backoff doubles (backoff_multiplier) after every
+ * failed attempt up to max_backoff and is randomised by jitter so that many clients
+ * do not reconnect in lockstep.
+ *
+ * After a reconnect a single read of 0x6003-0x6008 decides whether the cached
+ * topology and inventory still apply: the device rebooted if the hours since boot
+ * do not match the time elapsed since the last check or the module count at boot
+ * changed, and the topology changed if the module count differs. Only then are the
+ * topology and all product strings read again. A reboot that happens within the
+ * same hour as the previous check and keeps the module count is not detected.
+ *
+ * Not thread-safe; use it from one thread or guard it with a mutex.
+ */
+class ResilientSession {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /// Opens a connection to the device, nullptr if that fails
+    using ConnectionFactory = std::function<std::unique_ptr<libmodbus_cpp::ModbusConnection>()>;
+
+    using RevalidationHandler = std::function<void(Revalidation result)>;
+
+    /**
+     * @param factory Opens the connection
+     * @param options Backoff and failure detection options
+     */
+    explicit ResilientSession(ConnectionFactory factory, ResilientSessionOptions options = {});
+
+    /**
+     * @brief Make sure a validated connection exists
+     *
+     * Connects if no connection exists and the backoff has elapsed. Never waits.
+     *
+     * @param now Current time
+     * @return true if connected
+     */
+    bool ensure_connected(clock::time_point now = clock::now());
+
+    /**
+     * @brief Drop the connection and start the backoff
+     */
+    void disconnect(clock::time_point now = clock::now());
+
+    /**
+     * @brief Run an operation on the connection
+     *
+     * The operation must return a type whose default value means failure and that
+     * converts to bool, such as std::optional or bool, like the library functions do.
+     * A failed result counts towards failures_before_reconnect.
+     *
+     * @param fn Callable taking libmodbus_cpp::ModbusConnection&
+     * @return Result of fn, or its default value if not connected
+     */
+    template <typename F>
+    auto execute(F&& fn) -> std::invoke_result_t<F&, libmodbus_cpp::ModbusConnection&> {
+        using Result = std::invoke_result_t<F&, libmodbus_cpp::ModbusConnection&>;
+        static_assert(std::is_default_constructible_v<Result> && std::is_constructible_v<bool, Result>,
+                      "operation must return std::optional, bool or a similar type");
+        if (!ensure_connected()) {
+            return Result{};
+        }
+        Result result = fn(*conn_);
+        record_result(static_cast<bool>(result));
+        return result;
+    }
+
+    bool connected() const { return conn_ != nullptr; }
+
+    /**
+     * @brief Earliest time of the next connect attempt
+     */
+    clock::time_point next_attempt() const { return next_attempt_; }
+
+    /**
+     * @brief Cached topology, valid while connected
+     */
+    DeviceTopology& topology() { return topology_; }
+
+    /**
+     * @brief Cached inventory, read on the first connect and after reboots or topology changes
+     */
+    const std::optional<DeviceInventory>& inventory() const { return inventory_; }
+
+    /**
+     * @brief Register a handler called after every successful connect
+     */
+    void on_revalidation(RevalidationHandler handler) { on_revalidation_ = std::move(handler); }
+
+    /// Number of successful connects
+    uint64_t connects() const { return connects_; }
+
+    /// Number of full inventory reads
+    uint64_t inventory_reads() const { return inventory_reads_; }
+
+private:
+    bool connect(clock::time_point now);
+    std::optional<Revalidation> revalidate(clock::time_point now);
+    bool reload();
+    void schedule_retry(clock::time_point now);
+    void record_result(bool ok);
+
+    ConnectionFactory factory_;
+    ResilientSessionOptions options_;
+    std::unique_ptr<libmodbus_cpp::ModbusConnection> conn_;
+
+    clock::time_point next_attempt_{};
+    unsigned attempts_ = 0;
+    unsigned consecutive_failures_ = 0;
+    std::minstd_rand random_;
+
+    DeviceTopology topology_;
+    std::optional<DeviceInventory> inventory_;
+    std::optional<BootIdentity> identity_;
+    clock::time_point identity_time_{};
+
+    RevalidationHandler on_revalidation_;
+    uint64_t connects_ = 0;
+    uint64_t inventory_reads_ = 0;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "caparoc/mpsc_queue.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Shared Device Access
+// ============================================================================
+
+/**
+ * @brief Priority class of a SharedDevice command
+ */
+enum class Priority {
+    control,    // safety and control writes, e.g. switching channels off
+    normal,     // interactive reads and writes
+    background  // polling, inventory and other bulk reads
+};
+
+/// Number of Priority values
+constexpr size_t priority_count = static_cast<size_t>(Priority::background) + 1;
+
+/**
+ * @brief Queueing latency of one priority class
+ */
+struct QueueStatistics {
+    uint64_t commands = 0;
+    std::chrono::steady_clock::duration total_wait{};
+    std::chrono::steady_clock::duration max_wait{};
+    
+    std::chrono::steady_clock::duration mean_wait() const {
+        return commands ? total_wait / static_cast<int64_t>(commands) : std::chrono::steady_clock::duration{};
+    }
+};
+
+/**
+ * @brief Thread-safe handle to one device
+ * 
+ * A worker thread owns the connection and executes commands by priority, and in
+ * submission order within a priority class. Commands are passed through a lock-free
+ * MPSC queue, so any number of threads may submit concurrently. A running transaction
+ * is never interrupted, but reads longer than one PDU are split into chunks of
+ * max_read_registers, so a control command waits for at most one transaction of a read
+ * or read_status_snapshot(). A command passed to execute() runs as a single action, so
+ * a control command submitted meanwhile waits for all of its transactions.
+ * 
+ * Identical register reads are coalesced (single-flight): reads of the same range that
+ * are queued while such a read is being executed receive its result instead of
+ * causing another transaction, unless a write or an execute() was submitted before them
+ * and is still pending, or ran between the chunks of a split read.
+ */
+class SharedDevice {
+public:
+    /**
+     * @param conn Connection, owned by the worker thread from now on
+     */
+    explicit SharedDevice(std::unique_ptr<libmodbus_cpp::ModbusConnection> conn);
+    
+    /**
+     * @brief Execute all submitted commands and stop the worker
+     */
+    ~SharedDevice();
+    
+    SharedDevice(const SharedDevice&) = delete;
+    SharedDevice& operator=(const SharedDevice&) = delete;
+    
+    /**
+     * @brief Read consecutive registers (coalesced)
+     * 
+     * @param address First register
+     * @param count Number of registers, longer reads are split at PDU boundaries
+     * @param priority Priority class
+     * @return std::future<std::optional<std::vector<uint16_t>>> Values if successful
+     */
+    std::future<std::optional<std::vector<uint16_t>>> read_registers(uint16_t address, uint16_t count, Priority priority = Priority::normal);
+    
+    /**
+     * @brief Read a single register (coalesced), e.g. read_uint16(0x6001) for the total system current
+     */
+    std::future<std::optional<uint16_t>> read_uint16(uint16_t address, Priority priority = Priority::normal);
+    
+    /**
+     * @brief Write a single register
+     */
+    std::future<bool> write_uint16(uint16_t address, uint16_t value, Priority priority = Priority::normal);
+    
+    /**
+     * @brief Write consecutive registers
+     */
+    std::future<bool> write_registers(uint16_t address, std::vector<uint16_t> values, Priority priority = Priority::normal);
+    
+    /**
+     * @brief Switch a channel on/off (see caparoc::control_channel()), with control priority by default
+     * 
+     * The channel is validated against a topology kept by the worker, which is read on
+     * the first call and again after a failed write, so a switch costs one transaction.
+     */
+    std::future<bool> control_channel(uint8_t module_number, uint8_t channel_number, bool on, Priority priority = Priority::control);
+    
+    /**
+     * @brief Read the complete status block (see caparoc::read_status_snapshot())
+     * 
+     * Each request of status_snapshot_read_plan() is a separate read command, so higher
+     * priority commands can run between them and the parts of the snapshot may straddle
+     * a control write.
+     */
+    std::future<std::optional<StatusSnapshot>> read_status_snapshot(Priority priority = Priority::background);
+    
+    /**
+     * @brief Run any blocking library function on the worker thread
+     * 
+     * fn runs as one uninterruptible command. Prefer read_registers() for long reads.
+     * 
+     * @param fn Callable taking libmodbus_cpp::ModbusConnection&, e.g. a lambda calling read_inventory()
+     * @param priority Priority class
+     * @return std::future Result of fn, exceptions are forwarded
+     */
+    template <typename F>
+    auto execute(F fn, Priority priority = Priority::normal) -> std::future<std::invoke_result_t<F&, libmodbus_cpp::ModbusConnection&>> {
+        using Result = std::invoke_result_t<F&, libmodbus_cpp::ModbusConnection&>;
+        std::promise<Result> promise;
+        auto future = promise.get_future();
+        submit_action([fn = std::move(fn), promise = std::move(promise)](libmodbus_cpp::ModbusConnection& conn) mutable {
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    fn(conn);
+                    promise.set_value();
+                } else {
+                    promise.set_value(fn(conn));
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }, priority);
+        return future;
+    }
+    
+    /**
+     * @brief Number of reads answered from another read's transaction
+     */
+    uint64_t coalesced_reads() const { return coalesced_reads_.load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Time commands of a priority class waited before their first transaction
+     */
+    QueueStatistics statistics(Priority priority) const;
+
+private:
+    using clock = std::chrono::steady_clock;
+    using ReadCompletion = std::move_only_function<void(std::optional<std::span<const uint16_t>> values)>;
+    using Action = std::move_only_function<void(libmodbus_cpp::ModbusConnection& conn)>;
+    
+    struct Command {
+        uint64_t sequence;
+        Priority priority;
+        clock::time_point submitted;
+        uint16_t address;
+        uint16_t count;           // 0 for actions
+        ReadCompletion complete;  // reads
+        Action action;            // writes and execute()
+        
+        // Progress of reads longer than one PDU
+        std::vector<uint16_t> values;
+        uint16_t done = 0;
+        bool failed = false;
+        uint64_t interleaved = std::numeric_limits<uint64_t>::max();  // first action run between chunks
+        
+        bool is_read() const { return count != 0; }
+    };
+    
+    struct LaneStatistics {
+        std::atomic<uint64_t> commands = 0;
+        std::atomic<int64_t> total_wait = 0;
+        std::atomic<int64_t> max_wait = 0;
+    };
+    
+    void submit_read(uint16_t address, uint16_t count, Priority priority, ReadCompletion complete);
+    void submit_action(Action action, Priority priority);
+    void submit(Command command);
+    void record_wait(const Command& command);
+    void run();
+    
+    std::unique_ptr<libmodbus_cpp::ModbusConnection> conn_;
+    DeviceTopology topology_;  // worker thread only
+    MpscQueue<Command> queue_;
+    std::atomic<uint64_t> sequence_ = 0;
+    std::atomic<uint32_t> signal_ = 0;
+    std::atomic<bool> stopping_ = false;
+    std::atomic<uint64_t> coalesced_reads_ = 0;
+    std::array<LaneStatistics, priority_count> statistics_;
+    std::thread worker_;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Snapshot Publication
+// ============================================================================
+
+/**
+ * @brief Publishes values of T from one writer thread to any number of readers without locks
+ * 
+ * Seqlock: the writer makes the sequence odd, stores the value and makes it even again;
+ * readers copy the value and retry if the sequence changed meanwhile. The value is kept
+ * in atomic words, so concurrent copies are well-defined. Readers never block the
+ * writer, and a reader only retries while a publish is in progress, e.g.
+ * 
+ *     SnapshotPublisher<StatusSnapshot> latest;
+ *     // poller thread
+ *     if (auto snapshot = read_status_snapshot(conn)) latest.publish(*snapshot);
+ *     // any thread
+ *     if (auto snapshot = latest.read()) serve(*snapshot);
+ * 
+ * @tparam T Trivially copyable value type, e.g. StatusSnapshot or DeviceConfiguration
+ */
+template <typename T>
+class SnapshotPublisher {
+    static_assert(std::is_trivially_copyable_v<T>, "SnapshotPublisher requires a trivially copyable type");
+    
+public:
+    /**
+     * @brief Publish a new value (single writer thread)
+     */
+    void publish(const T& value) noexcept {
+        std::array<uint64_t, word_count> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+        
+        const uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < word_count; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Consistent copy of the latest value (any thread)
+     * 
+     * @return std::optional<T> Latest value, std::nullopt before the first publish()
+     */
+    std::optional<T> read() const noexcept {
+        std::array<uint64_t, word_count> words;
+        while (true) {
+            const uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before == 0) {
+                return std::nullopt;
+            }
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < word_count; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, words.data(), sizeof(T));
+        return value;
+    }
+    
+    /**
+     * @brief Number of completed publications, lets readers skip values they have already seen
+     */
+    uint64_t version() const noexcept {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr size_t word_count = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    
+    // Writer and readers touch the sequence constantly, keep it off the data's cache lines
+    alignas(64) std::atomic<uint64_t> sequence_ = 0;
+    alignas(64) std::array<std::atomic<uint64_t>, word_count> words_{};
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "caparoc/event_loop.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Coroutine Tasks
+// ============================================================================
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    std::exception_ptr exception;
+    
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            // Symmetric transfer back to the awaiting coroutine
+            return handle.promise().continuation;
+        }
+        
+        void await_resume() noexcept {}
+    };
+    
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { exception = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+    
+    Task<T> get_return_object() noexcept;
+    
+    template <typename U = T>
+    void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+    
+    T result() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object() noexcept;
+    
+    void return_void() noexcept {}
+    
+    void result() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+// Fire-and-forget coroutine that frees itself on completion
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine producing a T
+ * 
+ * A task starts running when it is awaited (or passed to spawn() or sync_wait())
+ * and resumes its awaiter when it completes.
+ */
+template <typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+    
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle) {
+    }
+    
+    Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, {})) {
+    }
+    
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+    
+    bool await_ready() const noexcept { return handle_.done(); }
+    
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    
+    T await_resume() { return handle_.promise().result(); }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+/**
+ * @brief Start a task without awaiting it
+ * 
+ * An exception escaping the task calls std::terminate(); use the overload taking a
+ * failure callback for tasks that may throw.
+ * 
+ * @param task Task to run
+ * @param done Called with the result (without arguments for Task<void>)
+ */
+template <typename T, typename Callback>
+void spawn(Task<T> task, Callback done) {
+    [](Task<T> task, Callback done) -> detail::Detached {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            done();
+        } else {
+            done(co_await std::move(task));
+        }
+    }(std::move(task), std::move(done));
+}
+
+/**
+ * @brief Start a task without awaiting it, reporting exceptions
+ * 
+ * @param task Task to run
+ * @param done Called with the result (without arguments for Task<void>) if the task succeeds
+ * @param failed Called with the std::exception_ptr if the task throws
+ */
+template <typename T, typename Callback, typename ErrorCallback>
+void spawn(Task<T> task, Callback done, ErrorCallback failed) {
+    [](Task<T> task, Callback done, ErrorCallback failed) -> detail::Detached {
+        // co_await is not allowed in a handler, so the exception is handled after the try block
+        std::exception_ptr exception;
+        std::conditional_t<std::is_void_v<T>, bool, std::optional<T>> result{};
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await std::move(task);
+            } else {
+                result.emplace(co_await std::move(task));
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        if (exception) {
+            failed(std::move(exception));
+        } else if constexpr (std::is_void_v<T>) {
+            done();
+        } else {
+            done(std::move(*result));
+        }
+    }(std::move(task), std::move(done), std::move(failed));
+}
+
+/**
+ * @brief Start a task without awaiting it and discard its result
+ * 
+ * An exception escaping the task calls std::terminate().
+ */
+template <typename T>
+void spawn(Task<T> task) {
+    if constexpr (std::is_void_v<T>) {
+        spawn(std::move(task), [] {});
+    } else {
+        spawn(std::move(task), [](T&&) {});
+    }
+}
+
+/**
+ * @brief Run the event loop until a task completes
+ * 
+ * Convenience for programs without their own loop thread. Exceptions of the task
+ * are rethrown.
+ */
+template <typename T>
+T sync_wait(EventLoop& loop, Task<T> task) {
+    bool finished = false;
+    std::exception_ptr exception;
+    std::conditional_t<std::is_void_v<T>, bool, std::optional<T>> result{};
+    
+    [](Task<T> task, bool& finished, std::exception_ptr& exception, auto& result) -> detail::Detached {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await std::move(task);
+            } else {
+                result.emplace(co_await std::move(task));
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        finished = true;
+    }(std::move(task), finished, exception, result);
+    
+    while (!finished) {
+        loop.run_once();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    if constexpr (!std::is_void_v<T>) {
+        return std::move(*result);
+    }
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <bitset>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+#include "caparoc/caparoc.hpp"
+#include "libmodbus_cpp/modbus_connection.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Topology Fingerprint
+// ============================================================================
+
+/// Serial number slots: power module (0), modules 1-16, QUINT power supply (17)
+constexpr size_t serial_slot_count = max_modules + 2;
+
+/// Slot of the QUINT power supply serial number
+constexpr size_t quint_serial_slot = max_modules + 1;
+
+/**
+ * @brief Address of the serial number string of a slot (0x1400-0x151F)
+ */
+constexpr uint16_t serial_number_address(size_t slot) {
+    return static_cast<uint16_t>(0x1400 + slot * 0x10);
+}
+
+/// FNV-1a 64 bit offset basis
+constexpr uint64_t fnv1a_offset_basis = 14695981039346656037ull;
+
+/**
+ * @brief FNV-1a 64 bit hash of register values, high byte first
+ *
+ * @param words Register values
+ * @param hash Offset basis or the hash of preceding data
+ */
+constexpr uint64_t fnv1a(std::span<const uint16_t> words, uint64_t hash = fnv1a_offset_basis) {
+    constexpr uint64_t prime = 1099511628211ull;
+    for (uint16_t word : words) {
+        hash = (hash ^ (word >> 8)) * prime;
+        hash = (hash ^ (word & 0xFF)) * prime;
+    }
+    return hash;
+}
+
+/**
+ * @brief Compact identity of the connected modules
+ *
+ * Slots of modules that are not connected have a serial hash of zero.
+ */
+struct TopologyFingerprint {
+    uint16_t module_count = 0;                                  // 0x2000
+    std::array<uint16_t, max_modules> channel_counts{};         // 0x2001-0x2010
+    std::array<uint64_t, serial_slot_count> serial_hashes{};    // fnv1a() of 0x1400-0x151F per slot
+
+    /**
+     * @brief Single 64 bit value covering counts and all serial hashes
+     */
+    uint64_t value() const;
+
+    bool operator==(const TopologyFingerprint&) const = default;
+};
+
+/**
+ * @brief Difference between two fingerprints
+ */
+struct TopologyChange {
+    TopologyFingerprint previous;
+    TopologyFingerprint current;
+    bool counts_changed;
+    std::bitset<serial_slot_count> serials_changed;
+};
+
+/**
+ * @brief Options for TopologyTracker
+ */
+struct TopologyTrackerOptions {
+    /// Serial numbers re-read per update(); 7 strings fit into one request
+    size_t serial_slots_per_update = 7;
+};
+
+/**
+ * @brief Detects module swaps by fingerprinting counts and serial numbers
+ *
+ * refresh() reads the module and channel counts and the serial numbers of all
+ * present slots. update() is the cheap incremental variant for poll loops: it
+ * re-reads the counts and the serial numbers of the next serial_slots_per_update
+ * slots in round-robin order, so with the defaults a swap is noticed within three
+ * updates at a cost of two requests each. A changed count triggers a full refresh.
+ *
+ * On a change, handlers are notified and attached DeviceTopology objects are
+ * invalidated. A handler can drop the identification, topology and configuration
+ * classes of a RegisterCache used with the device.
+ */
+class TopologyTracker {
+public:
+    using ChangeHandler = HandlerList<const TopologyChange&>::Handler;
+
+    explicit TopologyTracker(TopologyTrackerOptions options = {});
+
+    /**
+     * @brief Read counts and all serial numbers
+     *
+     * @param conn MODBUS connection
+     * @return std::optional<bool> Whether the fingerprint changed, std::nullopt if a read failed
+     */
+    std::optional<bool> refresh(libmodbus_cpp::ModbusConnection& conn);
+
+    /**
+     * @brief Read counts and the next batch of serial numbers (full refresh if not valid or counts changed)
+     *
+     * @param conn MODBUS connection
+     * @return std::optional<bool> Whether the fingerprint changed, std::nullopt if a read failed
+     */
+    std::optional<bool> update(libmodbus_cpp::ModbusConnection& conn);
+
+    bool valid() const { return valid_; }
+
+    const TopologyFingerprint& fingerprint() const { return fingerprint_; }
+
+    /**
+     * @brief Register a handler called whenever the fingerprint changes
+     *
+     * Handlers may add or remove handlers and attach or detach topologies. A handler
+     * removed during a notification is not called for it.
+     *
+     * @return size_t Handle for remove_change_handler()
+     */
+    size_t add_change_handler(ChangeHandler handler);
+
+    void remove_change_handler(size_t handle);
+
+    /**
+     * @brief Invalidate a topology cache on every change (detach it before destroying it)
+     */
+    void attach(DeviceTopology& topology);
+
+    void detach(DeviceTopology& topology);
+
+private:
+    std::optional<TopologyFingerprint> read_counts(libmodbus_cpp::ModbusConnection& conn) const;
+    bool read_serials(libmodbus_cpp::ModbusConnection& conn, std::span<const size_t> slots, TopologyFingerprint& fingerprint) const;
+    bool commit(const TopologyFingerprint& fingerprint);
+
+    TopologyTrackerOptions options_;
+    TopologyFingerprint fingerprint_;
+    bool valid_ = false;
+    size_t cursor_ = 0;
+    HandlerList<const TopologyChange&> handlers_;
+    std::vector<DeviceTopology*> topologies_;
+};
+
+} // namespace v1
+} // namespace caparoc
@@ -5,7 +5,7 @@ Generate C++ code for CAPAROC MODBUS registers from HTML specification
 import re
 import html
 
-def sanitize_name(name):
+def sanitize_name(name, max_length=60):
     """Convert register name to valid C++ identifier"""
     # Remove leading/trailing whitespace
     name = name.strip()
@@ -16,8 +16,8 @@ def sanitize_name(name):
     # Remove leading/trailing underscores
     name = name.strip('_')
     # Limit length
-    if len(name) > 60:
-        name = name[:60].rstrip('_')
+    if max_length is not None and len(name) > max_length:
+        name = name[:max_length].rstrip('_')
     return name
 
 def parse_registers(html_file):
@@ -54,6 +54,23 @@ def parse_registers(html_file):
     
     return registers
 
+def constant_names(registers):
+    """Assign a unique C++ identifier to every register"""
+    names = []
+    
+    # Track used names to avoid duplicates
+    used_names = set()
+    for reg in registers:
+        const_name = sanitize_name(reg['name']).upper()
+        
+        # Make name unique if it's already used
+        if const_name in used_names or not const_name:
+            const_name = f"REG_{reg['hex'][2:].upper()}"
+        
+        used_names.add(const_name)
+        names.append(const_name)
+    return names
+
 def generate_register_definitions(registers):
     """Generate register constant definitions"""
     lines = []
@@ -61,12 +78,9 @@ def generate_register_definitions(registers):
     lines.append("// Total registers: {}".format(len(registers)))
     lines.append("")
     
-    # Track used names to avoid duplicates
-    used_names = set()
-    
     # Group by address ranges
     current_group = None
-    for reg in registers:
+    for reg, const_name in zip(registers, constant_names(registers)):
         addr = reg['dec']
         
         # Determine group
@@ -86,18 +100,62 @@ def generate_register_definitions(registers):
             lines.append(f"// {group}")
             current_group = group
         
-        const_name = sanitize_name(reg['name']).upper()
-        
-        # Make name unique if it's already used
-        if const_name in used_names or not const_name:
-            const_name = f"REG_{reg['hex'][2:].upper()}"
-        
-        used_names.add(const_name)
-        
         lines.append(f"constexpr uint16_t {const_name} = {reg['hex']}; // {reg['access']}, {reg['type']}")
     
     return "\n".join(lines)
 
+# Units of the specification and their conversion to the unit stored in the table
+UNITS = {
+    'A': (1.0, 0.0, 'A'),
+    'mA': (0.001, 0.0, 'A'),
+    'V': (1.0, 0.0, 'V'),
+    'Hz': (1.0, 0.0, 'Hz'),
+    '°C': (1.0, 0.0, '°C'),
+    'K': (1.0, -273.15, '°C'),
+    '%': (1.0, 0.0, '%'),
+    'ms': (1.0, 0.0, 'ms'),
+    's': (1.0, 0.0, 's'),
+    'h': (1.0, 0.0, 'h'),
+    'd': (1.0, 0.0, 'd'),
+}
+
+UNIT = r'(mA|A|V|Hz|°C|K|%|ms|s|h|d)'
+FACTOR = r'(\d+(?:,\d+)?)?\s*\*?\s*'
+SCALING_PATTERNS = [
+    # "[]=0,1h", "[]= 0,01 V", "[]=mA, Resolution 100mA"
+    re.compile(r'^\[\]\s*=\s*' + FACTOR + UNIT + r'(?![A-Za-z])'),
+    # "2390 ... 2960 [0,01*V], Default: 2410"
+    re.compile(r'\[\s*' + FACTOR + UNIT + r'\s*\]'),
+    # "0...10000ms"
+    re.compile(r'^\d+\s*(?:\.\.\.|…)\s*\d+\s*()' + UNIT + r'$'),
+]
+
+# Registers whose description does not match what the device reports
+SCALING_OVERRIDES = {
+    0x6002: (0.01, 0.0, 'V'),  # input voltage, reported in 0.01 V
+    0x7012: (0.01, 0.0, 'A'),  # output currents, described as "0,01 V"
+    0x7013: (0.01, 0.0, 'A'),
+}
+
+def parse_scaling(reg):
+    """Return (scale, offset, unit) converting the raw value of a register, None if it has no unit"""
+    if reg['dec'] in SCALING_OVERRIDES:
+        return SCALING_OVERRIDES[reg['dec']]
+    # A 32 bit value split into MSB and LSB registers cannot be scaled word by word
+    if reg['type'] not in ('UINT16', 'INT16') or reg['num_regs'] != 1:
+        return None
+    for pattern in SCALING_PATTERNS:
+        match = pattern.search(reg['description'].strip())
+        if match:
+            factor = float(match.group(1).replace(',', '.')) if match.group(1) else 1.0
+            scale, offset, unit = UNITS[match.group(2)]
+            return (factor * scale, offset, unit)
+    return None
+
+def float_literal(value):
+    """Shortest C++ float literal for a value"""
+    return f"{float(value)!r}f"
+
 def generate_register_table(registers):
     """Generate register info table"""
     lines = []
@@ -108,43 +166,257 @@ def generate_register_table(registers):
         name_escaped = reg['name'].replace('"', '\\"')
         desc_escaped = reg['description'].replace('"', '\\"')
         
-        type_enum = {
-            'UINT16': 'RegisterType::UINT16',
-            'UINT32': 'RegisterType::UINT32',
-            'INT16': 'RegisterType::INT16',
-            'String32': 'RegisterType::STRING32'
-        }.get(reg['type'], 'RegisterType::UINT16')
+        type_enum = TYPE_ENUMS.get(reg['type'], TYPE_ENUMS['UINT16'])
         
-        access_enum = {
-            'RO': 'RegisterAccess::READ_ONLY',
-            'WO': 'RegisterAccess::WRITE_ONLY',
-            'RW': 'RegisterAccess::READ_WRITE'
-        }.get(reg['access'], 'RegisterAccess::READ_ONLY')
+        access_enum = ACCESS_ENUMS.get(reg['access'], ACCESS_ENUMS['RO'])
         
         lines.append(f'    {{{reg["hex"]}, {reg["num_regs"]}, {type_enum}, {access_enum},')
         lines.append(f'     "{name_escaped}",')
-        lines.append(f'     "{desc_escaped}"}},')
+        scaling = parse_scaling(reg)
+        if scaling:
+            scale, offset, unit = scaling
+            lines.append(f'     "{desc_escaped}", {float_literal(scale)}, {float_literal(offset)}, "{unit}"}},')
+        else:
+            lines.append(f'     "{desc_escaped}"}},')
     
     lines.append("};")
     lines.append(f"constexpr size_t register_table_size = {len(registers)};")
     
     return "\n".join(lines)
 
-if __name__ == '__main__':
-    registers = parse_registers('input/registers.html')
-    
-    print(f"Parsed {len(registers)} registers")
-    print(f"  Read-Only: {sum(1 for r in registers if r['access'] == 'RO')}")
-    print(f"  Write-Only: {sum(1 for r in registers if r['access'] == 'WO')}")
-    print(f"  Read-Write: {sum(1 for r in registers if r['access'] == 'RW')}")
-    
-    # Generate header file content
-    with open('include/caparoc/registers_generated.hpp', 'w') as f:
-        f.write("""#pragma once
+def generate_address_index(registers):
+    """Generate a two-level page index over the 16-bit address space and the lookup functions"""
+    pages = sorted({reg['dec'] >> 8 for reg in registers})
+    page_of = {page: i for i, page in enumerate(pages)}
+    slots = [[0] * 256 for _ in pages]
+    for i, reg in enumerate(registers):
+        slots[page_of[reg['dec'] >> 8]][reg['dec'] & 0xFF] = i + 1
+
+    lines = []
+    lines.append("// Address index: register_page_index[address >> 8] selects a row of register_page_slots")
+    lines.append("// (register_page_none if no register starts in that page), whose entry at address & 0xFF")
+    lines.append("// is the register_table index + 1 of the register starting at address (0: none)")
+    lines.append("constexpr uint8_t register_page_none = 0xFF;")
+    lines.append(f"constexpr size_t register_page_count = {len(pages)};")
+    lines.append("")
+    lines.append("constexpr uint8_t register_page_index[256] = {")
+    index = [page_of.get(page, 0xFF) for page in range(256)]
+    for row in range(0, 256, 16):
+        lines.append("    " + ", ".join(f"0x{v:02X}" for v in index[row:row + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr uint16_t register_page_slots[register_page_count][256] = {")
+    for page, page_slots in zip(pages, slots):
+        lines.append(f"    {{ // 0x{page:02X}00-0x{page:02X}FF")
+        for row in range(0, 256, 16):
+            lines.append("        " + ", ".join(str(v) for v in page_slots[row:row + 16]) + ",")
+        lines.append("    },")
+    lines.append("};")
+    lines.append("")
+    lines.append("""/**
+ * @brief Find the register starting at an address in constant time
+ *
+ * @param address Register address
+ * @return const RegisterInfo* Entry of register_table, nullptr if no register starts at address
+ */
+constexpr const RegisterInfo* find_register_info(uint16_t address) {
+    const uint8_t page = register_page_index[address >> 8];
+    if (page == register_page_none) {
+        return nullptr;
+    }
+    const uint16_t slot = register_page_slots[page][address & 0xFF];
+    return slot != 0 ? &register_table[slot - 1] : nullptr;
+}
+
+/**
+ * @brief Register starting at an address known at compile time
+ *
+ * Fails to compile if no register starts at address.
+ *
+ * @param address Register address
+ * @return const RegisterInfo& Entry of register_table
+ */
+consteval const RegisterInfo& static_register_info(uint16_t address) {
+    const RegisterInfo* info = find_register_info(address);
+    if (info == nullptr) {
+        throw "no register starts at this address";
+    }
+    return *info;
+}""")
+    return "\n".join(lines)
+
+VALUE_TYPES = {
+    'UINT16': ('uint16_t', 1),
+    'UINT32': ('uint32_t', 2),
+    'INT16': ('int16_t', 1),
+    'INT32': ('int32_t', 2),
+    'FLOAT': ('float', 2),
+    'String32': ('std::string', 16),
+}
+
+TYPE_ENUMS = {
+    'UINT16': 'RegisterType::UINT16',
+    'UINT32': 'RegisterType::UINT32',
+    'INT16': 'RegisterType::INT16',
+    'String32': 'RegisterType::STRING32'
+}
+
+ACCESS_ENUMS = {
+    'RO': 'RegisterAccess::READ_ONLY',
+    'WO': 'RegisterAccess::WRITE_ONLY',
+    'RW': 'RegisterAccess::READ_WRITE',
+}
+
+def generate_typed_registers(registers):
+    """Generate Register<> descriptors named like the address constants"""
+    lines = []
+    lines.append("// Typed register descriptors, named like the address constants in namespace registers")
+    lines.append("namespace regs {")
+    lines.append("")
+    for reg, const_name in zip(registers, constant_names(registers)):
+        value_type, words = VALUE_TYPES.get(reg['type'], VALUE_TYPES['UINT16'])
+        comment = ""
+        if words != reg['num_regs']:
+            # The specification lists some 32 bit values as separate MSB and LSB registers
+            if reg['num_regs'] != 1:
+                raise ValueError(f"{reg['hex']}: {reg['type']} occupies {words} registers, table says {reg['num_regs']}")
+            value_type, comment = 'uint16_t', f" // one word of a {reg['type']}"
+        access = ACCESS_ENUMS.get(reg['access'], ACCESS_ENUMS['RO'])
+        lines.append(f"using {const_name} = Register<{reg['hex']}, {value_type}, {access}>;{comment}")
+    lines.append("")
+    lines.append("} // namespace regs")
+    return "\n".join(lines)
+
+FAMILY_PATTERN = re.compile(r'^(.*?)\s*\bModule (\d+)(?:\s+Channel (\d+))?(.*)$')
+
+def detect_families(registers):
+    """Find registers that differ only in their module (and channel) number
+
+    Returns one descriptor per family whose members form a complete
+    module x channel grid with constant strides.
+    """
+    groups = {}
+    for reg in registers:
+        match = FAMILY_PATTERN.match(reg['name'].replace('\xa0', ' ').strip())
+        if not match:
+            continue
+        prefix, module, channel, suffix = match.groups()
+        key = (prefix.strip(), suffix.strip(), channel is not None)
+        groups.setdefault(key, []).append((int(module), int(channel or 1), reg))
+
+    families = []
+    for (prefix, suffix, per_channel), members in groups.items():
+        modules = max(m for m, _, _ in members)
+        channels = max(c for _, c, _ in members)
+        by_position = {(m, c): reg for m, c, reg in members}
+        if len(by_position) != len(members) or len(members) != modules * channels or modules < 2:
+            continue
+
+        base = by_position[(1, 1)]['dec']
+        module_stride = by_position[(2, 1)]['dec'] - base
+        channel_stride = by_position[(1, 2)]['dec'] - base if channels > 1 else 0
+        if any(reg['dec'] != base + (m - 1) * module_stride + (c - 1) * channel_stride for m, c, reg in members):
+            continue
+        first = by_position[(1, 1)]
+        if any(reg['type'] != first['type'] or reg['access'] != first['access'] for _, _, reg in members):
+            continue
+
+        name = sanitize_name(f"{prefix} {suffix}", max_length=None).upper()
+        families.append({
+            'name': name,
+            'base': base,
+            'module_stride': module_stride,
+            'channel_stride': channel_stride,
+            'modules': modules,
+            'channels': channels,
+            'num_regs': first['num_regs'],
+            'type': first['type'],
+            'access': first['access'],
+        })
+    return sorted(families, key=lambda family: family['base'])
+
+def generate_register_families(registers):
+    """Generate RegisterFamily descriptors"""
+    families = detect_families(registers)
+    lines = []
+    lines.append("// Registers that exist once per module or per module channel")
+    lines.append("namespace families {")
+    lines.append("")
+    for family in families:
+        value_type = TYPE_ENUMS.get(family['type'], TYPE_ENUMS['UINT16'])
+        access = ACCESS_ENUMS.get(family['access'], ACCESS_ENUMS['RO'])
+        lines.append(f"constexpr RegisterFamily {family['name']}{{\"{family['name'].lower()}\", "
+                     f"0x{family['base']:04X}, 0x{family['module_stride']:X}, {family['channel_stride']}, "
+                     f"{family['modules']}, {family['channels']}, {family['num_regs']}, {value_type}, {access}}};")
+    lines.append("")
+    lines.append("} // namespace families")
+    lines.append("")
+    lines.append("constexpr const RegisterFamily* register_family_table[] = {")
+    for family in families:
+        lines.append(f"    &families::{family['name']},")
+    lines.append("};")
+    lines.append(f"constexpr size_t register_family_count = {len(families)};")
+    return "\n".join(lines)
+
+def lower_ascii(text):
+    """Lowercase ASCII letters only, matching std::tolower in the C locale"""
+    return ''.join(c.lower() if c.isascii() else c for c in text)
+
+def escape(text):
+    return text.replace('"', '\\"')
+
+def generate_search_index(registers):
+    """Generate lowercase names and descriptions plus a token index for register search"""
+    tokens = {}
+    for i, reg in enumerate(registers):
+        text = lower_ascii(reg['name']) + ' ' + lower_ascii(reg['description'])
+        for token in set(re.split(r'[^a-z0-9]+', text)):
+            if token:
+                tokens.setdefault(token, set()).add(i)
+
+    lines = []
+    lines.append("// Lowercase names and descriptions, parallel to register_table")
+    lines.append("constexpr const char* register_names_lower[] = {")
+    for reg in registers:
+        lines.append(f'    "{escape(lower_ascii(reg["name"]))}",')
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr const char* register_descriptions_lower[] = {")
+    for reg in registers:
+        lines.append(f'    "{escape(lower_ascii(reg["description"]))}",')
+    lines.append("};")
+    lines.append("")
+    lines.append("// Alphanumeric token of a lowercase name or description and the registers containing it")
+    lines.append("struct RegisterToken {")
+    lines.append("    const char* text;")
+    lines.append("    uint16_t first;  // first entry in register_token_postings")
+    lines.append("    uint16_t count;  // number of registers")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Tokens sorted by text")
+    lines.append("constexpr RegisterToken register_tokens[] = {")
+    postings = []
+    for token in sorted(tokens):
+        lines.append(f'    {{"{token}", {len(postings)}, {len(tokens[token])}}},')
+        postings.extend(sorted(tokens[token]))
+    lines.append("};")
+    lines.append(f"constexpr size_t register_token_count = {len(tokens)};")
+    lines.append("")
+    lines.append("// register_table indices per token, ascending")
+    lines.append("constexpr uint16_t register_token_postings[] = {")
+    for row in range(0, len(postings), 16):
+        lines.append("    " + ", ".join(str(v) for v in postings[row:row + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+HEADER_PROLOGUE = """#pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <string>
 
 namespace caparoc {
+inline namespace v1 {
 
 // Register access types
 enum class RegisterAccess {
@@ -171,14 +443,87 @@ struct RegisterInfo {
     RegisterAccess access;
     const char* name;
     const char* description;
+    float scale = 1.0f;    // physical value = raw value * scale + offset
+    float offset = 0.0f;
+    const char* unit = "";  // unit of the physical value, empty for counts, bit fields and strings
+};
+
+// Number of registers occupied by a value of type T
+template <typename T>
+constexpr uint16_t register_words = sizeof(T) / sizeof(uint16_t);
+
+template <>
+inline constexpr uint16_t register_words<std::string> = 16;
+
+// Register whose address, value type and access mode are known at compile time
+template <uint16_t Address, typename T, RegisterAccess Access>
+struct Register {
+    using value_type = T;
+    static constexpr uint16_t address = Address;
+    static constexpr uint16_t num_registers = register_words<T>;
+    static constexpr RegisterAccess access = Access;
+};
+
+// Registers that repeat per module (and channel) with constant strides
+struct RegisterFamily {
+    const char* name;
+    uint16_t base;            // address for module 1, channel 1
+    uint16_t module_stride;   // address distance between modules
+    uint16_t channel_stride;  // address distance between channels, 0 for per-module families
+    uint8_t modules;
+    uint8_t channels;         // 1 for per-module families
+    uint16_t num_registers;   // registers per member
+    RegisterType type;
+    RegisterAccess access;
+
+    // Address of the member for a module (1-based) and channel (1-based)
+    constexpr uint16_t address(uint8_t module_number, uint8_t channel_number = 1) const {
+        return static_cast<uint16_t>(base + (module_number - 1) * module_stride + (channel_number - 1) * channel_stride);
+    }
+
+    // Number of registers from the first member to the end of the last member of a module
+    constexpr uint16_t module_span() const {
+        return static_cast<uint16_t>((channels - 1) * channel_stride + num_registers);
+    }
+
+    // Number of registers from the first member to the end of the last member
+    constexpr uint16_t span() const {
+        return static_cast<uint16_t>((modules - 1) * module_stride + module_span());
+    }
 };
 
 namespace registers {
 
-""")
-        f.write(generate_register_definitions(registers))
-        f.write("\n\n} // namespace registers\n\n")
-        f.write(generate_register_table(registers))
-        f.write("\n\n} // namespace caparoc\n")
+"""
+
+def generate_header(registers):
+    """Generate the complete header file content"""
+    registers = sorted(registers, key=lambda reg: reg['dec'])
+    parts = [HEADER_PROLOGUE]
+    parts.append(generate_register_definitions(registers))
+    parts.append("\n\n} // namespace registers\n\n")
+    parts.append(generate_typed_registers(registers))
+    parts.append("\n\n")
+    parts.append(generate_register_families(registers))
+    parts.append("\n\n")
+    parts.append(generate_register_table(registers))
+    parts.append("\n\n")
+    parts.append(generate_address_index(registers))
+    parts.append("\n\n")
+    parts.append(generate_search_index(registers))
+    parts.append("\n\n} // namespace v1\n} // namespace caparoc\n")
+    return "".join(parts)
+
+if __name__ == '__main__':
+    registers = parse_registers('input/registers.html')
+    
+    print(f"Parsed {len(registers)} registers")
+    print(f"  Read-Only: {sum(1 for r in registers if r['access'] == 'RO')}")
+    print(f"  Write-Only: {sum(1 for r in registers if r['access'] == 'WO')}")
+    print(f"  Read-Write: {sum(1 for r in registers if r['access'] == 'RW')}")
+    
+    # Generate header file content
+    with open('include/caparoc/registers_generated.hpp', 'w') as f:
+        f.write(generate_header(registers))
     
     print("Generated include/caparoc/registers_generated.hpp")
@@ -0,0 +1,88 @@
+#include "caparoc/async.hpp"
+#include <algorithm>
+#include <array>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Awaitable Transactions
+// ============================================================================
+
+bool ReadPlanRequests::await_suspend(std::coroutine_handle<> awaiting) {
+    // One extra count held by this loop, so the coroutine cannot resume (and destroy
+    // plan_) while requests are still being issued, even if callbacks run early
+    remaining_ = plan_.requests.size() + 1;
+    for (const auto& request : plan_.requests) {
+        session_.read_registers(request.address, request.count,
+            [this, awaiting, address = request.address](std::error_code error, std::span<const uint16_t> values) {
+                if (error) {
+                    if (!error_) {
+                        error_ = error;
+                    }
+                } else {
+                    values_.assign(address, values);
+                }
+                if (--remaining_ == 0) {
+                    awaiting.resume();
+                }
+            });
+    }
+    // All requests already completed: continue without suspending
+    return --remaining_ != 0;
+}
+
+std::optional<RegisterValues> ReadPlanRequests::await_resume() {
+    if (error_) {
+        return std::nullopt;
+    }
+    return std::move(values_);
+}
+
+// ============================================================================
+// Asynchronous Device Functions
+// ============================================================================
+
+Task<std::optional<uint16_t>> read_uint16(ModbusTcpSession& session, uint16_t address) {
+    auto values = co_await read_registers(session, address, 1);
+    if (!values) {
+        co_return std::nullopt;
+    }
+    co_return (*values)[0];
+}
+
+Task<bool> write_uint16(ModbusTcpSession& session, uint16_t address, uint16_t value) {
+    const uint16_t values[] = {value};
+    co_return co_await write_registers(session, address, values);
+}
+
+Task<std::optional<GlobalStatus>> get_global_status(ModbusTcpSession& session) {
+    auto value = co_await read_uint16(session, 0x6000);
+    if (!value) {
+        co_return std::nullopt;
+    }
+    co_return decode_global_status(*value);
+}
+
+Task<std::optional<RegisterValues>> execute_read_plan(ModbusTcpSession& session, ReadPlan plan) {
+    co_return co_await ReadPlanRequests(session, std::move(plan));
+}
+
+Task<std::optional<StatusSnapshot>> read_status_snapshot(ModbusTcpSession& session) {
+    const auto& plan = status_snapshot_read_plan();
+    auto values = co_await ReadPlanRequests(session, plan);
+    if (!values) {
+        co_return std::nullopt;
+    }
+    
+    std::array<uint16_t, status_block_size> block{};
+    for (const auto& request : plan.requests) {
+        std::ranges::copy(values->get(request.address, request.count), block.begin() + (request.address - status_block_address));
+    }
+    co_return decode_status_snapshot(block);
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -1,9 +1,10 @@
 #include "caparoc/caparoc.hpp"
+#include "caparoc/physical_decoder.hpp"
+#include "caparoc/read_planner.hpp"
 #include "caparoc/registers.hpp"
 #include <format>
 #include <sstream>
 #include <algorithm>
-#include <cctype>
 #include <stdexcept>
 #include <thread>
 #include <chrono>
@@ -17,7 +18,7 @@ inline namespace v1 {
 
 std::optional<uint16_t> read_uint16(libmodbus_cpp::ModbusConnection& conn, uint16_t address) {
     uint16_t value;
-    if (!conn.read_register(address, value)) {
+    if (!read_registers(conn, address, std::span(&value, 1))) {
         return std::nullopt;
     }
     return value;
@@ -25,7 +26,7 @@ std::optional<uint16_t> read_uint16(libmodbus_cpp::ModbusConnection& conn, uint1
 
 std::optional<uint32_t> read_uint32(libmodbus_cpp::ModbusConnection& conn, uint16_t address) {
     uint16_t values[2];
-    if (!conn.read_registers(address, 2, values)) {
+    if (!read_registers(conn, address, values)) {
         return std::nullopt;
     }
     // MODBUS uses big endian: values[0] is high word, values[1] is low word
@@ -34,17 +35,20 @@ std::optional<uint32_t> read_uint32(libmodbus_cpp::ModbusConnection& conn, uint1
 
 std::optional<std::string> read_string32(libmodbus_cpp::ModbusConnection& conn, uint16_t address) {
     uint16_t values[16];  // 32 bytes = 16 registers
-    if (!conn.read_registers(address, 16, values)) {
+    if (!read_registers(conn, address, values)) {
         return std::nullopt;
     }
-    
+    return decode_string(values);
+}
+
+std::string decode_string(std::span<const uint16_t> values) {
     // Convert to string (2 bytes per register, big-endian MODBUS format)
     // Each register contains 2 bytes: high byte first, then low byte
     std::string result;
-    result.reserve(32);
-    for (int i = 0; i < 16; ++i) {
-        result += static_cast<char>((values[i] >> 8) & 0xFF);
-        result += static_cast<char>(values[i] & 0xFF);
+    result.reserve(values.size() * 2);
+    for (uint16_t value : values) {
+        result += static_cast<char>((value >> 8) & 0xFF);
+        result += static_cast<char>(value & 0xFF);
     }
     
     // Trim null bytes
@@ -57,7 +61,7 @@ std::optional<std::string> read_string32(libmodbus_cpp::ModbusConnection& conn,
 }
 
 bool write_uint16(libmodbus_cpp::ModbusConnection& conn, uint16_t address, uint16_t value) {
-    return conn.write_register(address, value);
+    return write_registers(conn, address, std::span(&value, 1));
 }
 
 bool write_uint32(libmodbus_cpp::ModbusConnection& conn, uint16_t address, uint32_t value) {
@@ -65,44 +69,39 @@ bool write_uint32(libmodbus_cpp::ModbusConnection& conn, uint16_t address, uint3
     // MODBUS uses big endian: values[0] is high word, values[1] is low word
     values[0] = (value >> 16) & 0xFFFF;
     values[1] = value & 0xFFFF;
-    return conn.write_registers(address, 2, values);
+    return write_registers(conn, address, values);
+}
+
+bool read_registers(libmodbus_cpp::ModbusConnection& conn, uint16_t address, std::span<uint16_t> values) {
+    if (values.empty() || values.size() > max_read_registers) {
+        return false;
+    }
+    return conn.read_registers(address, static_cast<int>(values.size()), values.data());
+}
+
+bool write_registers(libmodbus_cpp::ModbusConnection& conn, uint16_t address, std::span<const uint16_t> values) {
+    if (values.empty() || values.size() > max_write_registers) {
+        return false;
+    }
+    if (values.size() == 1) {
+        return conn.write_register(address, values[0]);
+    }
+    return conn.write_registers(address, static_cast<int>(values.size()), values.data());
 }
 
 // ============================================================================
 // Validation Utility Functions
 // ============================================================================
 
-static void validate_module_number(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number) {
-    auto num_modules_opt = get_number_of_connected_modules(conn);
-    if (!num_modules_opt) {
-        throw std::invalid_argument("Failed to read number of connected modules from device");
-    }
-    uint16_t num_modules = *num_modules_opt;
-    
-    if (module_number < 1 || module_number > num_modules) {
-        throw std::invalid_argument(std::format(
-            "Invalid module number: {}. Expected value between 1 and {} (number of connected modules)",
-            module_number, num_modules
-        ));
-    }
+// Refresh the topology if needed and validate module (and channel) number locally.
+static void validate_module_number(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number) {
+    topology.ensure_valid(conn);
+    topology.validate_module_number(module_number);
 }
 
-static void validate_channel_number(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number) {
-    auto num_channels_opt = get_number_of_channels_for_module(conn, module_number);
-    if (!num_channels_opt) {
-        throw std::invalid_argument(std::format(
-            "Failed to read number of channels for module {} from device",
-            module_number
-        ));
-    }
-    uint16_t num_channels = *num_channels_opt;
-    
-    if (channel_number < 1 || channel_number > num_channels) {
-        throw std::invalid_argument(std::format(
-            "Invalid channel number: {} for module {}. Expected value between 1 and {} (number of channels for this module)",
-            channel_number, module_number, num_channels
-        ));
-    }
+static void validate_channel_number(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    topology.ensure_valid(conn);
+    topology.validate_channel_number(module_number, channel_number);
 }
 
 // ============================================================================
@@ -134,9 +133,18 @@ std::optional<std::string> get_product_name_power_module(libmodbus_cpp::ModbusCo
 }
 
 std::optional<std::string> get_product_name_module(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number) {
-    validate_module_number(conn, module_number);
-    uint16_t address = 0x1010 + (module_number - 1) * 0x10;
-    return read_string32(conn, address);
+    DeviceTopology topology;
+    return get_product_name_module(conn, topology, module_number);
+}
+
+std::optional<std::string> get_product_name_module(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number) {
+    validate_module_number(conn, topology, module_number);
+    uint16_t address = families::PRODUCT_NAME.address(module_number);
+    auto name = read_string32(conn, address);
+    if (!name) {
+        topology.invalidate();
+    }
+    return name;
 }
 
 std::optional<std::string> get_product_name_quint(libmodbus_cpp::ModbusConnection& conn) {
@@ -148,45 +156,43 @@ std::optional<std::string> get_product_name_quint(libmodbus_cpp::ModbusConnectio
 // ============================================================================
 
 std::string get_register_info(uint16_t address) {
-    for (size_t i = 0; i < register_table_size; ++i) {
-        if (register_table[i].address == address) {
-            const auto& reg = register_table[i];
-            
-            std::string type_str;
-            switch (reg.type) {
-                case RegisterType::UINT16: type_str = "UINT16"; break;
-                case RegisterType::INT16: type_str = "INT16"; break;
-                case RegisterType::UINT32: type_str = "UINT32"; break;
-                case RegisterType::INT32: type_str = "INT32"; break;
-                case RegisterType::FLOAT: type_str = "FLOAT"; break;
-                case RegisterType::STRING32: type_str = "STRING32"; break;
-            }
-            
-            std::string access_str;
-            switch (reg.access) {
-                case RegisterAccess::READ_ONLY: access_str = "RO"; break;
-                case RegisterAccess::WRITE_ONLY: access_str = "WO"; break;
-                case RegisterAccess::READ_WRITE: access_str = "RW"; break;
-            }
-            
-            return std::format(
-                "Address: 0x{:04X} ({} dec)\n"
-                "Registers: {}\n"
-                "Type: {}\n"
-                "Access: {}\n"
-                "Name: {}\n"
-                "Description: {}",
-                reg.address, reg.address,
-                reg.num_registers,
-                type_str,
-                access_str,
-                reg.name,
-                reg.description
-            );
-        }
+    const RegisterInfo* info = find_register_info(address);
+    if (info == nullptr) {
+        return std::format("Register at address 0x{:04X} not found", address);
+    }
+    const auto& reg = *info;
+    
+    std::string type_str;
+    switch (reg.type) {
+        case RegisterType::UINT16: type_str = "UINT16"; break;
+        case RegisterType::INT16: type_str = "INT16"; break;
+        case RegisterType::UINT32: type_str = "UINT32"; break;
+        case RegisterType::INT32: type_str = "INT32"; break;
+        case RegisterType::FLOAT: type_str = "FLOAT"; break;
+        case RegisterType::STRING32: type_str = "STRING32"; break;
     }
     
-    return std::format("Register at address 0x{:04X} not found", address);
+    std::string access_str;
+    switch (reg.access) {
+        case RegisterAccess::READ_ONLY: access_str = "RO"; break;
+        case RegisterAccess::WRITE_ONLY: access_str = "WO"; break;
+        case RegisterAccess::READ_WRITE: access_str = "RW"; break;
+    }
+    
+    return std::format(
+        "Address: 0x{:04X} ({} dec)\n"
+        "Registers: {}\n"
+        "Type: {}\n"
+        "Access: {}\n"
+        "Name: {}\n"
+        "Description: {}",
+        reg.address, reg.address,
+        reg.num_registers,
+        type_str,
+        access_str,
+        reg.name,
+        reg.description
+    );
 }
 
 std::string list_all_registers(const std::string& filter) {
@@ -195,30 +201,8 @@ std::string list_all_registers(const std::string& filter) {
     oss << "===========================\n";
     oss << std::format("Total registers: {}\n", register_table_size);
     
-    // Convert filter to lowercase for case-insensitive search
-    std::string filter_lower = filter;
-    std::transform(filter_lower.begin(), filter_lower.end(), filter_lower.begin(),
-                   [](unsigned char c){ return std::tolower(c); });
-    
     int count = 0;
-    for (size_t i = 0; i < register_table_size; ++i) {
-        const auto& reg = register_table[i];
-        
-        // Apply filter if provided
-        if (!filter.empty()) {
-            std::string name_lower = reg.name;
-            std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(),
-                          [](unsigned char c){ return std::tolower(c); });
-            std::string desc_lower = reg.description;
-            std::transform(desc_lower.begin(), desc_lower.end(), desc_lower.begin(),
-                          [](unsigned char c){ return std::tolower(c); });
-            
-            if (name_lower.find(filter_lower) == std::string::npos &&
-                desc_lower.find(filter_lower) == std::string::npos) {
-                continue;
-            }
-        }
-        
+    for (const auto& reg : search_registers(filter, RegisterSearchScope::name_and_description)) {
         std::string type_str;
         switch (reg.type) {
             case RegisterType::UINT16: type_str = "UINT16"; break;
@@ -267,25 +251,85 @@ std::string list_all_registers(const std::string& filter) {
 }
 
 std::vector<RegisterInfo> find_registers(const std::string& pattern) {
-    std::vector<RegisterInfo> result;
+    const auto matches = search_registers(pattern);
+    return std::vector<RegisterInfo>(matches.begin(), matches.end());
+}
+
+namespace {
+
+char ascii_lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool is_token_char(char c) {
+    c = ascii_lower(c);
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+}
+
+// Case-insensitive substring test against text that is already lowercase
+bool contains_lowered(std::string_view text_lower, std::string_view pattern) {
+    if (pattern.size() > text_lower.size()) {
+        return false;
+    }
+    for (size_t i = 0; i + pattern.size() <= text_lower.size(); ++i) {
+        size_t j = 0;
+        while (j < pattern.size() && text_lower[i + j] == ascii_lower(pattern[j])) {
+            ++j;
+        }
+        if (j == pattern.size()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Every match contains the longest alphanumeric run of the pattern within a single token
+std::string_view longest_fragment(std::string_view pattern) {
+    std::string_view longest;
+    size_t start = 0;
+    for (size_t i = 0; i <= pattern.size(); ++i) {
+        if (i == pattern.size() || !is_token_char(pattern[i])) {
+            if (i - start > longest.size()) {
+                longest = pattern.substr(start, i - start);
+            }
+            start = i + 1;
+        }
+    }
+    return longest;
+}
+
+} // namespace
+
+RegisterSearchResult search_registers(std::string_view pattern, RegisterSearchScope scope) {
+    std::bitset<register_table_size> matches;
+    if (pattern.empty()) {
+        return RegisterSearchResult(matches.set());
+    }
     
-    std::string pattern_lower = pattern;
-    std::transform(pattern_lower.begin(), pattern_lower.end(), pattern_lower.begin(),
-                   [](unsigned char c){ return std::tolower(c); });
+    std::bitset<register_table_size> candidates;
+    const auto fragment = longest_fragment(pattern);
+    if (fragment.empty()) {
+        candidates.set();
+    } else {
+        for (const auto& token : register_tokens) {
+            if (contains_lowered(token.text, fragment)) {
+                for (uint16_t i = 0; i < token.count; ++i) {
+                    candidates.set(register_token_postings[token.first + i]);
+                }
+            }
+        }
+    }
     
     for (size_t i = 0; i < register_table_size; ++i) {
-        const auto& reg = register_table[i];
-        
-        std::string name_lower = reg.name;
-        std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(),
-                      [](unsigned char c){ return std::tolower(c); });
-        
-        if (name_lower.find(pattern_lower) != std::string::npos) {
-            result.push_back(reg);
+        if (!candidates.test(i)) {
+            continue;
+        }
+        if (contains_lowered(register_names_lower[i], pattern) ||
+            (scope == RegisterSearchScope::name_and_description && contains_lowered(register_descriptions_lower[i], pattern))) {
+            matches.set(i);
         }
     }
-    
-    return result;
+    return RegisterSearchResult(matches);
 }
 
 std::optional<uint16_t> get_number_of_connected_modules(libmodbus_cpp::ModbusConnection& conn) {
@@ -296,27 +340,27 @@ std::optional<uint16_t> get_number_of_channels_for_module(libmodbus_cpp::ModbusC
     if (module_number < 1 || module_number > 16) {
         return std::nullopt;
     }
-    // Register address: 0x2001 + (module_number - 1)
-    uint16_t address = 0x2001 + (module_number - 1);
+    uint16_t address = families::NO_OF_CHANNELS.address(module_number);
     return read_uint16(conn, address);
 }
 
 bool set_nominal_current(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number, uint16_t nominal_current) {
-    validate_module_number(conn, module_number);
-    validate_channel_number(conn, module_number, channel_number);
+    DeviceTopology topology;
+    return set_nominal_current(conn, topology, module_number, channel_number, nominal_current);
+}
+
+bool set_nominal_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number, uint16_t nominal_current) {
+    validate_channel_number(conn, topology, module_number, channel_number);
 
     // Check if module is CAPAROC E2 12-24DC/2-10A (manual rotary dial only)
-    auto product_name_opt = get_product_name_module(conn, module_number);
+    auto product_name_opt = get_product_name_module(conn, topology, module_number);
     if (product_name_opt && product_name_opt->find("CAPAROC E2 12-24DC/2-10A") != std::string::npos) {
         throw std::invalid_argument(
             "Module is CAPAROC E2 12-24DC/2-10A. Nominal current must be set physically via the rotary dials."
         );
     }
     
-    // Calculate register address
-    // Base address: 0xC050
-    // Formula: 0xC050 + (module_number - 1) * 4 + (channel_number - 1)
-    uint16_t address = 0xC050 + (module_number - 1) * 4 + (channel_number - 1);
+    uint16_t address = families::NOMINAL_CURRENT.address(module_number, channel_number);
 
     // Read device's max CAPAROC bus cycle (0x6006) to determine appropriate spacing
     uint16_t max_bus_cycle_ms = 100;  // Default fallback
@@ -329,7 +373,7 @@ bool set_nominal_current(libmodbus_cpp::ModbusConnection& conn, uint8_t module_n
 
     // Unlock nominal current parametrization (channel then global)
     const uint16_t global_lock_address = 0xC001;
-    const uint16_t channel_lock_address = 0xC090 + (module_number - 1) * 4 + (channel_number - 1);
+    const uint16_t channel_lock_address = families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.address(module_number, channel_number);
     
     constexpr auto kDelay = std::chrono::milliseconds(50);
     constexpr int kRetries = 5;
@@ -382,22 +426,50 @@ bool set_nominal_current(libmodbus_cpp::ModbusConnection& conn, uint8_t module_n
 }
 
 std::optional<uint16_t> get_nominal_current(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number) {
-    validate_module_number(conn, module_number);
-    validate_channel_number(conn, module_number, channel_number);
+    DeviceTopology topology;
+    return get_nominal_current(conn, topology, module_number, channel_number);
+}
+
+std::optional<uint16_t> get_nominal_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    validate_channel_number(conn, topology, module_number, channel_number);
     
-    // Calculate register address
-    // Base address: 0xC050
-    // Formula: 0xC050 + (module_number - 1) * 4 + (channel_number - 1)
-    uint16_t address = 0xC050 + (module_number - 1) * 4 + (channel_number - 1);
+    uint16_t address = families::NOMINAL_CURRENT.address(module_number, channel_number);
     
-    return read_uint16(conn, address);
+    auto value = read_uint16(conn, address);
+    if (!value) {
+        topology.invalidate();
+    }
+    return value;
 }
 
 std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
+    return print_device_info(conn, Deadline::max());
+}
+
+std::string print_device_info(libmodbus_cpp::ModbusConnection& conn, Deadline deadline, std::stop_token stop) {
     std::ostringstream oss;
     
+    // Get number of connected modules and their channel counts in one read
+    DeviceTopology topology;
+    const bool topology_valid = !budget_exhausted(deadline, stop) && topology.refresh(conn);
+    const uint16_t num_modules = topology.module_count();
+    
+    // Read product names of power module, connected modules and QUINT with planned block reads
+    std::vector<ReadRequest> name_ranges = {{0x1000, 16}, {0x1110, 16}};
+    for (uint16_t module = 1; module <= num_modules; ++module) {
+        name_ranges.push_back(family_module_range(families::PRODUCT_NAME, static_cast<uint8_t>(module)));
+    }
+    const auto names = execute_read_plan(conn, plan_reads(std::span<const ReadRequest>(name_ranges)), deadline, stop);
+    auto product_name_at = [&names](uint16_t address) -> std::optional<std::string> {
+        auto words = names.get(address, 16);
+        if (words.empty()) {
+            return std::nullopt;
+        }
+        return decode_string(words);
+    };
+    
     // Get power module product name
-    auto power_module_name = get_product_name_power_module(conn);
+    auto power_module_name = product_name_at(0x1000);
     if (power_module_name) {
         oss << std::format("Power Module: {}\n", *power_module_name);
     }
@@ -405,66 +477,54 @@ std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
     // System Status
     oss << "\n=== System Status ===\n";
     
-    auto global_status = get_global_status(conn);
-    if (global_status) {
+    // Status, measurements and per-channel values come from one snapshot
+    const auto partial = read_status_snapshot(conn, deadline, stop);
+    const auto& snapshot = partial.snapshot;
+    if (partial.header_valid) {
+        const auto& global_status = snapshot.global_status;
         oss << "Global Status: ";
         bool has_error = false;
-        if (global_status->undervoltage) { oss << "UNDERVOLTAGE "; has_error = true; }
-        if (global_status->overvoltage) { oss << "OVERVOLTAGE "; has_error = true; }
-        if (global_status->cumulative_channel_error) { oss << "CHANNEL_ERROR "; has_error = true; }
-        if (global_status->cumulative_80_warning) { oss << "80%_WARNING "; has_error = true; }
-        if (global_status->system_current_too_high) { oss << "SYSTEM_CURRENT_HIGH "; has_error = true; }
+        if (global_status.undervoltage) { oss << "UNDERVOLTAGE "; has_error = true; }
+        if (global_status.overvoltage) { oss << "OVERVOLTAGE "; has_error = true; }
+        if (global_status.cumulative_channel_error) { oss << "CHANNEL_ERROR "; has_error = true; }
+        if (global_status.cumulative_80_warning) { oss << "80%_WARNING "; has_error = true; }
+        if (global_status.system_current_too_high) { oss << "SYSTEM_CURRENT_HIGH "; has_error = true; }
         if (!has_error) { oss << "OK"; }
         oss << "\n";
+        
+        const auto& measurements = snapshot.measurements;
+        oss << std::format("Total System Current: {} A\n", measurements.total_system_current);
+        oss << std::format("Input Voltage: {:.2f} V\n", to_physical(static_register_info(registers::INPUT_VOLTAGE), measurements.input_voltage));
+        oss << std::format("Sum of Nominal Currents: {} A\n", measurements.sum_of_nominal_currents);
+        oss << std::format("Internal Temperature: {} °C\n", measurements.internal_temperature);
     }
     
-    auto total_current = get_total_system_current(conn);
-    if (total_current) {
-        oss << std::format("Total System Current: {} A\n", *total_current);
-    }
-    
-    auto input_voltage = get_input_voltage(conn);
-    if (input_voltage) {
-        oss << std::format("Input Voltage: {:.2f} V\n", *input_voltage / 100.0);
-    }
-    
-    auto sum_nominal = get_sum_of_nominal_currents(conn);
-    if (sum_nominal) {
-        oss << std::format("Sum of Nominal Currents: {} A\n", *sum_nominal);
-    }
-    
-    auto temperature = get_internal_temperature(conn);
-    if (temperature) {
-        oss << std::format("Internal Temperature: {} °C\n", *temperature);
-    }
-    
-    // Get number of connected modules
-    auto num_modules_opt = get_number_of_connected_modules(conn);
-    if (!num_modules_opt) {
+    if (!topology_valid) {
         oss << "\nError: Failed to read number of connected modules\n";
         return oss.str();
     }
     
-    uint16_t num_modules = *num_modules_opt;
     oss << std::format("\n=== Connected Modules: {} ===\n", num_modules);
     
+    // Read nominal currents of all connected channels with planned block reads
+    std::vector<ReadRequest> nominal_ranges;
+    for (uint16_t module = 1; module <= num_modules; ++module) {
+        if (uint16_t num_channels = topology.channel_count(static_cast<uint8_t>(module))) {
+            nominal_ranges.push_back({families::NOMINAL_CURRENT.address(static_cast<uint8_t>(module)), num_channels});
+        }
+    }
+    const auto nominal_currents = execute_read_plan(conn, plan_reads(std::span<const ReadRequest>(nominal_ranges)), deadline, stop);
+    
     // Get information for each connected module
     for (uint16_t module = 1; module <= num_modules; ++module) {
         // Get product name for this module
-        auto product_name = get_product_name_module(conn, static_cast<uint8_t>(module));
+        auto product_name = product_name_at(families::PRODUCT_NAME.address(static_cast<uint8_t>(module)));
         if (!product_name) {
             oss << std::format("Module {}: Error reading product name\n", module);
             continue;
         }
         
-        // Get number of channels for this module
-        auto num_channels_opt = get_number_of_channels_for_module(conn, static_cast<uint8_t>(module));
-        if (!num_channels_opt) {
-            oss << std::format("Module {}: {} (Error reading channel count)\n", module, *product_name);
-            continue;
-        }
-        
-        uint16_t num_channels = *num_channels_opt;
+        uint16_t num_channels = topology.channel_count(static_cast<uint8_t>(module));
         oss << std::format("Module {}: {} ({} channels)\n", module, *product_name, num_channels);
         
         // Get current and status for each channel
@@ -472,13 +532,13 @@ std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
             oss << std::format("  Channel {}: ", channel);
             
             // Get nominal current
-            auto nominal_current = read_uint16(conn, 0xC050 + (module - 1) * 4 + (channel - 1));
+            auto nominal_current = nominal_currents.get(families::NOMINAL_CURRENT.address(static_cast<uint8_t>(module), static_cast<uint8_t>(channel)));
             
-            // Get actual load current
-            auto load = get_load_current(conn, static_cast<uint8_t>(module), static_cast<uint8_t>(channel));
+            // Actual load current and status come from the snapshot
+            const size_t index = channel_index(static_cast<uint8_t>(module), static_cast<uint8_t>(channel));
             
-            if (nominal_current && load) {
-                double load_amps = *load / 1000.0;  // Convert mA to A
+            if (nominal_current && partial.load_current_valid.test(index)) {
+                double load_amps = to_physical(static_register_info(families::LOAD_CURRENT.base), snapshot.load_current[index]);
                 oss << std::format("{:.1f} A / {} A", load_amps, *nominal_current);
             } else if (nominal_current) {
                 oss << std::format("? A / {} A", *nominal_current);
@@ -486,18 +546,17 @@ std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
                 oss << "Error reading currents";
             }
             
-            // Get status
-            auto status = get_channel_status(conn, static_cast<uint8_t>(module), static_cast<uint8_t>(channel));
-            if (status) {
+            if (partial.channel_status_valid.test(index)) {
+                const auto& status = snapshot.channel_status[index];
                 oss << " [";
                 bool has_error = false;
-                if (status->short_circuit) { oss << "SHORT_CIRCUIT "; has_error = true; }
-                if (status->overload) { oss << "OVERLOAD "; has_error = true; }
-                if (status->hardware_error) { oss << "HW_ERROR "; has_error = true; }
-                if (status->voltage_error) { oss << "VOLTAGE_ERROR "; has_error = true; }
-                if (status->warning_80_percent) { oss << "80%_WARNING "; has_error = true; }
-                if (status->module_current_too_high) { oss << "MODULE_CURRENT_HIGH "; has_error = true; }
-                if (status->system_current_too_high) { oss << "SYSTEM_CURRENT_HIGH "; has_error = true; }
+                if (status.short_circuit) { oss << "SHORT_CIRCUIT "; has_error = true; }
+                if (status.overload) { oss << "OVERLOAD "; has_error = true; }
+                if (status.hardware_error) { oss << "HW_ERROR "; has_error = true; }
+                if (status.voltage_error) { oss << "VOLTAGE_ERROR "; has_error = true; }
+                if (status.warning_80_percent) { oss << "80%_WARNING "; has_error = true; }
+                if (status.module_current_too_high) { oss << "MODULE_CURRENT_HIGH "; has_error = true; }
+                if (status.system_current_too_high) { oss << "SYSTEM_CURRENT_HIGH "; has_error = true; }
                 if (!has_error) { oss << "OK"; }
                 oss << "]";
             }
@@ -507,7 +566,7 @@ std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
     }
     
     // Get QUINT power supply info
-    auto quint_name = get_product_name_quint(conn);
+    auto quint_name = product_name_at(0x1110);
     if (quint_name) {
         oss << std::format("\nQUINT Power Supply: {}\n", *quint_name);
     }
@@ -519,78 +578,574 @@ std::string print_device_info(libmodbus_cpp::ModbusConnection& conn) {
 // System Status and Monitoring Functions
 // ============================================================================
 
+GlobalStatus decode_global_status(uint16_t value) {
+    GlobalStatus status;
+    status.undervoltage = (value & 0x01) != 0;
+    status.overvoltage = (value & 0x02) != 0;
+    status.cumulative_channel_error = (value & 0x04) != 0;
+    status.cumulative_80_warning = (value & 0x08) != 0;
+    status.system_current_too_high = (value & 0x10) != 0;
+    
+    return status;
+}
+
+ChannelStatus decode_channel_status(uint16_t value) {
+    ChannelStatus status;
+    status.warning_80_percent = (value & 0x01) != 0;
+    status.overload = (value & 0x02) != 0;
+    status.short_circuit = (value & 0x04) != 0;
+    status.hardware_error = (value & 0x08) != 0;
+    status.voltage_error = (value & 0x10) != 0;
+    status.module_current_too_high = (value & 0x20) != 0;
+    status.system_current_too_high = (value & 0x40) != 0;
+    
+    return status;
+}
+
+SystemMeasurements decode_system_measurements(std::span<const uint16_t, system_measurements_size> values) {
+    constexpr uint16_t base = 0x6001;
+    
+    SystemMeasurements m;
+    m.total_system_current = values[0x6001 - base];
+    m.input_voltage = values[0x6002 - base];
+    m.connected_modules = values[0x6003 - base];
+    m.connected_modules_at_boot = values[0x6004 - base];
+    m.sum_of_nominal_currents = values[0x6005 - base];
+    m.max_caparoc_bus_cycle_ms = values[0x6006 - base];
+    m.max_quint_power_bus_cycle_ms = values[0x6007 - base];
+    m.hours_since_last_boot = values[0x6008 - base];
+    m.internal_temperature = static_cast<int16_t>(values[0x6009 - base]);
+    return m;
+}
+
+StatusSnapshot decode_status_snapshot(std::span<const uint16_t, status_block_size> block) {
+    constexpr uint16_t base = status_block_address;
+    
+    StatusSnapshot snapshot;
+    snapshot.global_status = decode_global_status(block[0x6000 - base]);
+    
+    snapshot.measurements = decode_system_measurements(block.subspan<0x6001 - base, system_measurements_size>());
+    
+    for (size_t i = 0; i < max_channels; ++i) {
+        snapshot.channel_status[i] = decode_channel_status(block[0x6010 - base + i]);
+        snapshot.load_current[i] = block[0x6050 - base + i];
+        snapshot.error_counter[i] = block[0x6090 - base + i];
+    }
+    
+    return snapshot;
+}
+
+std::optional<StatusSnapshot> read_status_snapshot(libmodbus_cpp::ModbusConnection& conn) {
+    // The planner skips the unmapped 0x600A-0x600F and splits the rest at the PDU limit
+    std::array<uint16_t, status_block_size> block{};
+    for (const auto& request : status_snapshot_read_plan().requests) {
+        auto values = std::span(block).subspan(request.address - status_block_address, request.count);
+        if (!read_registers(conn, request.address, values)) {
+            return std::nullopt;
+        }
+    }
+    return decode_status_snapshot(block);
+}
+
+PartialStatusSnapshot read_status_snapshot(libmodbus_cpp::ModbusConnection& conn, Deadline deadline, std::stop_token stop) {
+    std::array<uint16_t, status_block_size> block{};
+    std::bitset<status_block_size> received;
+    for (const auto& request : status_snapshot_read_plan().requests) {
+        if (budget_exhausted(deadline, stop)) {
+            break;
+        }
+        const size_t offset = request.address - status_block_address;
+        if (!read_registers(conn, request.address, std::span(block).subspan(offset, request.count))) {
+            break;
+        }
+        for (size_t i = 0; i < request.count; ++i) {
+            received.set(offset + i);
+        }
+    }
+    
+    // Decoding the zero-filled image keeps fields that were not read at zero
+    PartialStatusSnapshot result;
+    result.snapshot = decode_status_snapshot(block);
+    result.header_valid = true;
+    for (uint16_t address = 0x6000; address < 0x600A; ++address) {
+        result.header_valid = result.header_valid && received.test(address - status_block_address);
+    }
+    for (size_t i = 0; i < max_channels; ++i) {
+        result.channel_status_valid[i] = received.test(0x6010 - status_block_address + i);
+        result.load_current_valid[i] = received.test(0x6050 - status_block_address + i);
+        result.error_counter_valid[i] = received.test(0x6090 - status_block_address + i);
+    }
+    return result;
+}
+
 std::optional<GlobalStatus> get_global_status(libmodbus_cpp::ModbusConnection& conn) {
     auto val = read_uint16(conn, 0x6000);
     if (!val) {
         return std::nullopt;
     }
-    
-    GlobalStatus status;
-    status.undervoltage = (*val & 0x01) != 0;
-    status.overvoltage = (*val & 0x02) != 0;
-    status.cumulative_channel_error = (*val & 0x04) != 0;
-    status.cumulative_80_warning = (*val & 0x08) != 0;
-    status.system_current_too_high = (*val & 0x10) != 0;
-    
-    return status;
+    return decode_global_status(*val);
 }
 
 std::optional<uint16_t> get_total_system_current(libmodbus_cpp::ModbusConnection& conn) {
-    return read_uint16(conn, 0x6001);
+    return read<regs::TOTAL_SYSTEM_CURRENT>(conn);
 }
 
 std::optional<uint16_t> get_input_voltage(libmodbus_cpp::ModbusConnection& conn) {
-    return read_uint16(conn, 0x6002);
+    return read<regs::INPUT_VOLTAGE>(conn);
 }
 
 std::optional<uint16_t> get_sum_of_nominal_currents(libmodbus_cpp::ModbusConnection& conn) {
-    return read_uint16(conn, 0x6005);
+    return read<regs::SUM_OF_NOMINAL_CURRENTS>(conn);
 }
 
 std::optional<int16_t> get_internal_temperature(libmodbus_cpp::ModbusConnection& conn) {
-    auto val = read_uint16(conn, 0x6009);
-    if (!val) {
-        return std::nullopt;
-    }
-    return static_cast<int16_t>(*val);
+    return read<regs::INTERNAL_TEMPERATURE>(conn);
 }
 
 std::optional<ChannelStatus> get_channel_status(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number) {
-    validate_module_number(conn, module_number);
-    validate_channel_number(conn, module_number, channel_number);
+    DeviceTopology topology;
+    return get_channel_status(conn, topology, module_number, channel_number);
+}
+
+std::optional<ChannelStatus> get_channel_status(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    validate_channel_number(conn, topology, module_number, channel_number);
     
-    uint16_t address = 0x6010 + (module_number - 1) * 4 + (channel_number - 1);
+    uint16_t address = families::STATUS.address(module_number, channel_number);
     auto val = read_uint16(conn, address);
     if (!val) {
+        topology.invalidate();
         return std::nullopt;
     }
-    
-    ChannelStatus status;
-    status.warning_80_percent = (*val & 0x01) != 0;
-    status.overload = (*val & 0x02) != 0;
-    status.short_circuit = (*val & 0x04) != 0;
-    status.hardware_error = (*val & 0x08) != 0;
-    status.voltage_error = (*val & 0x10) != 0;
-    status.module_current_too_high = (*val & 0x20) != 0;
-    status.system_current_too_high = (*val & 0x40) != 0;
-    
-    return status;
+    return decode_channel_status(*val);
 }
 
 std::optional<uint16_t> get_load_current(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number) {
-    validate_module_number(conn, module_number);
-    validate_channel_number(conn, module_number, channel_number);
+    DeviceTopology topology;
+    return get_load_current(conn, topology, module_number, channel_number);
+}
+
+std::optional<uint16_t> get_load_current(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    validate_channel_number(conn, topology, module_number, channel_number);
     
-    uint16_t address = 0x6050 + (module_number - 1) * 4 + (channel_number - 1);
-    return read_uint16(conn, address);
+    uint16_t address = families::LOAD_CURRENT.address(module_number, channel_number);
+    auto value = read_uint16(conn, address);
+    if (!value) {
+        topology.invalidate();
+    }
+    return value;
 }
 
 bool control_channel(libmodbus_cpp::ModbusConnection& conn, uint8_t module_number, uint8_t channel_number, bool on) {
-    validate_module_number(conn, module_number);
-    validate_channel_number(conn, module_number, channel_number);
+    DeviceTopology topology;
+    return control_channel(conn, topology, module_number, channel_number, on);
+}
+
+bool control_channel(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number, bool on) {
+    validate_channel_number(conn, topology, module_number, channel_number);
+    
+    uint16_t address = families::CONTROL_CHANNEL.address(module_number, channel_number);
+    if (!write_uint16(conn, address, on ? 1 : 0)) {
+        topology.invalidate();
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Inventory Functions
+// ============================================================================
+
+std::optional<DeviceInventory> read_inventory(libmodbus_cpp::ModbusConnection& conn) {
+    DeviceTopology topology;
+    return read_inventory(conn, topology);
+}
+
+std::optional<DeviceInventory> read_inventory(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology) {
+    if (!topology.valid() && !topology.refresh(conn)) {
+        return std::nullopt;
+    }
+    const uint16_t num_modules = topology.module_count();
+    
+    // Each block holds the power module at +0x000, modules at +0x010..+0x100 and QUINT at +0x110
+    struct StringBlock {
+        uint16_t base;
+        std::string ProductInfo::* field;
+    };
+    static constexpr StringBlock blocks[] = {
+        {0x1000, &ProductInfo::product_name},
+        {0x1200, &ProductInfo::product_id},
+        {0x1400, &ProductInfo::serial_number},
+        {0x1600, &ProductInfo::hardware_version},
+        {0x1800, &ProductInfo::firmware_version},
+    };
+    auto slot_address = [](uint16_t base, uint16_t slot) {
+        return static_cast<uint16_t>(base + slot * 0x10);
+    };
+    constexpr uint16_t quint_slot = max_modules + 1;
+    
+    // Strings are atomic units for the planner, so 7 of them fit into one request
+    std::vector<RegisterInfo> strings;
+    for (size_t i = 0; i < register_table_size; ++i) {
+        const auto& reg = register_table[i];
+        if (reg.type != RegisterType::STRING32) {
+            continue;
+        }
+        for (const auto& block : blocks) {
+            if (reg.address >= block.base && reg.address < block.base + 0x200) {
+                const uint16_t slot = (reg.address - block.base) / 0x10;
+                if (slot <= num_modules || slot == quint_slot) {
+                    strings.push_back(reg);
+                }
+            }
+        }
+    }
+    
+    auto values = execute_read_plan(conn, plan_reads(std::span<const RegisterInfo>(strings)));
+    if (!values) {
+        return std::nullopt;
+    }
+    
+    auto read_product_info = [&](uint16_t slot) {
+        ProductInfo info;
+        for (const auto& block : blocks) {
+            auto words = values->get(slot_address(block.base, slot), 16);
+            if (!words.empty()) {
+                info.*block.field = decode_string(words);
+            }
+        }
+        return info;
+    };
+    
+    DeviceInventory inventory{};
+    inventory.power_module = read_product_info(0);
+    inventory.module_count = num_modules;
+    for (uint16_t module = 1; module <= num_modules; ++module) {
+        inventory.channel_counts[module - 1] = topology.channel_count(static_cast<uint8_t>(module));
+        inventory.modules[module - 1] = read_product_info(module);
+    }
+    inventory.quint = read_product_info(quint_slot);
+    
+    return inventory;
+}
+
+// ============================================================================
+// Batched Parametrization Functions
+// ============================================================================
+
+namespace {
+
+// Contiguous range of channel slots [first, first + count) written with one request
+struct ChannelRun {
+    size_t first;
+    size_t count;
+};
+
+// Group the selected slots into runs that only span existing channels
+std::vector<ChannelRun> channel_runs(const std::bitset<max_channels>& selected, const std::bitset<max_channels>& existing) {
+    std::vector<ChannelRun> runs;
+    std::optional<size_t> last;
+    for (size_t i = 0; i < max_channels; ++i) {
+        if (!selected.test(i)) {
+            continue;
+        }
+        bool contiguous = last.has_value();
+        for (size_t j = last.value_or(i) + 1; contiguous && j < i; ++j) {
+            contiguous = existing.test(j);
+        }
+        if (contiguous) {
+            runs.back().count = i - runs.back().first + 1;
+        } else {
+            runs.push_back({i, 1});
+        }
+        last = i;
+    }
+    return runs;
+}
+
+// Write one value per slot of every run: fill(index) supplies the value
+template <typename Fill>
+bool write_runs(libmodbus_cpp::ModbusConnection& conn, uint16_t base, const std::vector<ChannelRun>& runs, Fill fill) {
+    std::array<uint16_t, max_channels> values{};
+    for (const auto& run : runs) {
+        for (size_t i = 0; i < run.count; ++i) {
+            values[i] = fill(run.first + i);
+        }
+        if (!write_registers(conn, static_cast<uint16_t>(base + run.first), std::span(values).first(run.count))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool apply_nominal_currents(libmodbus_cpp::ModbusConnection& conn, std::span<const NominalAssignment> assignments) {
+    DeviceTopology topology;
+    return apply_nominal_currents(conn, topology, assignments);
+}
+
+bool apply_nominal_currents(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, std::span<const NominalAssignment> assignments) {
+    if (assignments.empty()) {
+        return true;
+    }
+    
+    topology.ensure_valid(conn);
+    
+    std::bitset<max_channels> affected;
+    std::bitset<max_modules> affected_modules;
+    std::array<uint16_t, max_channels> desired{};
+    for (const auto& assignment : assignments) {
+        topology.validate_channel_number(assignment.module_number, assignment.channel_number);
+        const size_t index = channel_index(assignment.module_number, assignment.channel_number);
+        affected.set(index);
+        affected_modules.set(assignment.module_number - 1);
+        desired[index] = assignment.nominal_current;
+    }
+    
+    // Check for CAPAROC E2 12-24DC/2-10A modules (manual rotary dial only), names in one planned read
+    std::vector<ReadRequest> name_ranges;
+    for (uint8_t module = 1; module <= max_modules; ++module) {
+        if (affected_modules.test(module - 1)) {
+            name_ranges.push_back(family_module_range(families::PRODUCT_NAME, module));
+        }
+    }
+    if (auto names = execute_read_plan(conn, plan_reads(std::span<const ReadRequest>(name_ranges)))) {
+        for (const auto& range : name_ranges) {
+            if (decode_string(names->get(range.address, range.count)).find("CAPAROC E2 12-24DC/2-10A") != std::string::npos) {
+                throw std::invalid_argument(std::format(
+                    "Module {} is CAPAROC E2 12-24DC/2-10A. Nominal current must be set physically via the rotary dials.",
+                    (range.address - families::PRODUCT_NAME.base) / families::PRODUCT_NAME.module_stride + 1
+                ));
+            }
+        }
+    }
+    
+    // Runs never extend into a module without assignments, it was not checked for E2 above
+    std::bitset<max_channels> writable = topology.channel_mask();
+    for (size_t i = 0; i < max_channels; ++i) {
+        if (!affected_modules.test(i / channels_per_module)) {
+            writable.reset(i);
+        }
+    }
+    const auto runs = channel_runs(affected, writable);
+    
+    // Channels inside a run that are not assigned keep their nominal current and lock state
+    std::vector<ReadRequest> run_ranges;
+    std::vector<ReadRequest> nominal_ranges;
+    for (const auto& run : runs) {
+        nominal_ranges.push_back({static_cast<uint16_t>(families::NOMINAL_CURRENT.base + run.first), static_cast<uint16_t>(run.count)});
+        run_ranges.push_back(nominal_ranges.back());
+        run_ranges.push_back({static_cast<uint16_t>(families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.base + run.first), static_cast<uint16_t>(run.count)});
+    }
+    const bool has_bystanders = std::ranges::any_of(runs, [&](const ChannelRun& run) {
+        for (size_t i = run.first; i < run.first + run.count; ++i) {
+            if (!affected.test(i)) {
+                return true;
+            }
+        }
+        return false;
+    });
+    
+    std::array<uint16_t, max_channels> previous_nominal{};
+    std::array<uint16_t, max_channels> previous_lock{};
+    previous_lock.fill(1);
+    if (has_bystanders) {
+        auto current = execute_read_plan(conn, plan_reads(std::span<const ReadRequest>(run_ranges)));
+        if (!current) {
+            return false;
+        }
+        for (const auto& run : runs) {
+            for (size_t i = run.first; i < run.first + run.count; ++i) {
+                previous_nominal[i] = current->get(static_cast<uint16_t>(families::NOMINAL_CURRENT.base + i)).value_or(0);
+                previous_lock[i] = current->get(static_cast<uint16_t>(families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.base + i)).value_or(1);
+            }
+        }
+    }
+    
+    auto nominal_value = [&](size_t index) {
+        return affected.test(index) ? desired[index] : previous_nominal[index];
+    };
+    
+    // Read device's max CAPAROC bus cycle (0x6006) to determine appropriate spacing
+    uint16_t max_bus_cycle_ms = 100;  // Default fallback
+    if (auto max_cycle_opt = read_uint16(conn, 0x6006)) {
+        max_bus_cycle_ms = *max_cycle_opt;
+    }
+    // Wait for at least (bus_cycle + 50ms) once before the lock/unlock sequence
+    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(max_bus_cycle_ms) + 50));
+    
+    const uint16_t global_lock_address = 0xC001;
+    constexpr auto kDelay = std::chrono::milliseconds(50);
+    constexpr int kRetries = 5;
+    
+    // Restore locks: assigned channels are locked, others get their previous state back
+    auto relock = [&] {
+        bool ok = write_uint16(conn, global_lock_address, 1);
+        std::this_thread::sleep_for(kDelay);
+        ok = write_runs(conn, families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.base, runs, [&](size_t index) -> uint16_t {
+            return affected.test(index) ? 1 : previous_lock[index];
+        }) && ok;
+        return ok;
+    };
+    
+    // Unlock nominal current parametrization (channels then global)
+    if (!write_runs(conn, families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.base, runs, [](size_t) -> uint16_t { return 0; })) {
+        relock();
+        return false;
+    }
+    std::this_thread::sleep_for(kDelay);
+    if (!write_uint16(conn, global_lock_address, 0)) {
+        relock();
+        return false;
+    }
+    std::this_thread::sleep_for(kDelay);
+    
+    // Write with retry + single block read-back to mitigate timing issues
+    const auto verify_plan = plan_reads(std::span<const ReadRequest>(nominal_ranges));
+    bool verified = false;
+    for (int attempt = 0; attempt < kRetries && !verified; ++attempt) {
+        if (!write_runs(conn, families::NOMINAL_CURRENT.base, runs, nominal_value)) {
+            std::this_thread::sleep_for(kDelay);
+            continue;
+        }
+        std::this_thread::sleep_for(kDelay);
+        if (auto verify = execute_read_plan(conn, verify_plan)) {
+            verified = std::ranges::all_of(runs, [&](const ChannelRun& run) {
+                for (size_t i = run.first; i < run.first + run.count; ++i) {
+                    if (verify->get(static_cast<uint16_t>(families::NOMINAL_CURRENT.base + i)) != nominal_value(i)) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+        }
+        if (!verified) {
+            std::this_thread::sleep_for(kDelay);
+        }
+    }
+    
+    // Re-lock nominal current parametrization, also after a failed verification
+    if (!relock() || !verified) {
+        return false;
+    }
+    
+    // Allow device to settle after write operation before next command
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
     
-    uint16_t address = 0xC010 + (module_number - 1) * 4 + (channel_number - 1);
-    return write_uint16(conn, address, on ? 1 : 0);
+    return true;
+}
+
+// ============================================================================
+// Channel Switching Functions
+// ============================================================================
+
+std::optional<std::bitset<max_channels>> get_channel_states(libmodbus_cpp::ModbusConnection& conn) {
+    std::array<uint16_t, max_channels> values{};
+    if (!read_registers(conn, families::CONTROL_CHANNEL.base, values)) {
+        return std::nullopt;
+    }
+    
+    std::bitset<max_channels> states;
+    for (size_t i = 0; i < max_channels; ++i) {
+        states[i] = values[i] != 0;
+    }
+    return states;
+}
+
+bool set_channel_states(libmodbus_cpp::ModbusConnection& conn, const std::bitset<max_channels>& states, const ChannelSwitchOptions& options) {
+    DeviceTopology topology;
+    return set_channel_states(conn, topology, states, options);
+}
+
+bool set_channel_states(libmodbus_cpp::ModbusConnection& conn, DeviceTopology& topology, const std::bitset<max_channels>& states, const ChannelSwitchOptions& options) {
+    topology.ensure_valid(conn);
+    const auto existing = topology.channel_mask();
+    
+    auto current = get_channel_states(conn);
+    if (!current) {
+        topology.invalidate();
+        return false;
+    }
+    
+    const auto changed = (states ^ *current) & options.mask & existing;
+    if (changed.none()) {
+        return true;
+    }
+    
+    // Changed channels get their new state, unchanged ones inside a run keep the current one
+    auto state_value = [&](size_t index) -> uint16_t {
+        return changed.test(index) ? states.test(index) : current->test(index);
+    };
+    
+    if (!options.staggered_switch_on) {
+        if (!write_runs(conn, families::CONTROL_CHANNEL.base, channel_runs(changed, existing), state_value)) {
+            topology.invalidate();
+            return false;
+        }
+        return true;
+    }
+    
+    // Switch off in bulk first, then energise one channel after the other
+    const auto switch_off = changed & ~states;
+    const auto switch_on = changed & states;
+    if (switch_off.any() && !write_runs(conn, families::CONTROL_CHANNEL.base, channel_runs(switch_off, existing), [&](size_t index) -> uint16_t {
+            return switch_off.test(index) ? 0 : current->test(index);
+        })) {
+        topology.invalidate();
+        return false;
+    }
+    
+    const auto delay = std::chrono::milliseconds(read_uint16(conn, 0xC000).value_or(0));
+    bool first = true;
+    for (size_t i = 0; i < max_channels; ++i) {
+        if (!switch_on.test(i)) {
+            continue;
+        }
+        if (!first) {
+            std::this_thread::sleep_for(delay);
+        }
+        first = false;
+        if (!write_uint16(conn, static_cast<uint16_t>(families::CONTROL_CHANNEL.base + i), 1)) {
+            topology.invalidate();
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+// ============================================================================
+// Configuration Functions
+// ============================================================================
+
+std::optional<DeviceConfiguration> read_configuration(libmodbus_cpp::ModbusConnection& conn) {
+    // 0xC003-0xC00F is unmapped, so the block is planned as two ranges
+    static const ReadPlan plan = [] {
+        const ReadRequest ranges[] = {
+            {0xC000, 0xC003 - 0xC000},
+            {0xC010, 0xC0D0 - 0xC010},
+        };
+        return plan_reads(std::span<const ReadRequest>(ranges));
+    }();
+    
+    auto values = execute_read_plan(conn, plan);
+    if (!values) {
+        return std::nullopt;
+    }
+    
+    DeviceConfiguration config;
+    config.switch_on_delay = *values->get(0xC000);
+    config.nominal_current_lock = *values->get(0xC001) != 0;
+    config.local_user_interface_lock = *values->get(0xC002) != 0;
+    const auto control = values->get(families::CONTROL_CHANNEL.base, max_channels);
+    const auto nominal = values->get(families::NOMINAL_CURRENT.base, max_channels);
+    const auto locks = values->get(families::NOMINAL_CURRENT_PARAMETRIZATION_LOCK.base, max_channels);
+    for (size_t i = 0; i < max_channels; ++i) {
+        config.channel_on[i] = control[i] != 0;
+        config.nominal_current[i] = nominal[i];
+        config.channel_lock[i] = locks[i] != 0;
+    }
+    return config;
 }
 
 } // namespace v1
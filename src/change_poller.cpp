@@ -0,0 +1,117 @@
+#include "caparoc/change_poller.hpp"
+#include <utility>
+
+namespace caparoc {
+inline namespace v1 {
+
+namespace {
+
+constexpr std::pair<GlobalStatusBit, bool GlobalStatus::*> global_status_bits[] = {
+    {GlobalStatusBit::undervoltage, &GlobalStatus::undervoltage},
+    {GlobalStatusBit::overvoltage, &GlobalStatus::overvoltage},
+    {GlobalStatusBit::cumulative_channel_error, &GlobalStatus::cumulative_channel_error},
+    {GlobalStatusBit::cumulative_80_warning, &GlobalStatus::cumulative_80_warning},
+    {GlobalStatusBit::system_current_too_high, &GlobalStatus::system_current_too_high},
+};
+
+constexpr std::pair<ChannelStatusBit, bool ChannelStatus::*> channel_status_bits[] = {
+    {ChannelStatusBit::warning_80_percent, &ChannelStatus::warning_80_percent},
+    {ChannelStatusBit::overload, &ChannelStatus::overload},
+    {ChannelStatusBit::short_circuit, &ChannelStatus::short_circuit},
+    {ChannelStatusBit::hardware_error, &ChannelStatus::hardware_error},
+    {ChannelStatusBit::voltage_error, &ChannelStatus::voltage_error},
+    {ChannelStatusBit::module_current_too_high, &ChannelStatus::module_current_too_high},
+    {ChannelStatusBit::system_current_too_high, &ChannelStatus::system_current_too_high},
+};
+
+} // namespace
+
+// ============================================================================
+// Change Detection
+// ============================================================================
+
+void ChangePoller::on_global_status_change(GlobalStatusHandler handler) {
+    global_status_handlers_.add(std::move(handler));
+}
+
+void ChangePoller::on_channel_status_change(ChannelStatusHandler handler) {
+    channel_status_handlers_.add(std::move(handler));
+}
+
+void ChangePoller::on_load_current_change(LoadCurrentHandler handler) {
+    load_current_handlers_.add(std::move(handler));
+}
+
+void ChangePoller::on_module_count_change(ModuleCountHandler handler) {
+    module_count_handlers_.add(std::move(handler));
+}
+
+void ChangePoller::set_load_current_deadband(uint16_t deadband_ma) {
+    deadband_.fill(deadband_ma);
+}
+
+void ChangePoller::set_load_current_deadband(uint8_t module_number, uint8_t channel_number, uint16_t deadband_ma) {
+    if (module_number < 1 || module_number > max_modules || channel_number < 1 || channel_number > channels_per_module) {
+        return;
+    }
+    deadband_[channel_index(module_number, channel_number)] = deadband_ma;
+}
+
+bool ChangePoller::poll(libmodbus_cpp::ModbusConnection& conn) {
+    auto snapshot = read_status_snapshot(conn);
+    if (!snapshot) {
+        return false;
+    }
+    process(*snapshot);
+    return true;
+}
+
+void ChangePoller::process(const StatusSnapshot& snapshot) {
+    if (!previous_) {
+        previous_ = snapshot;
+        reported_load_current_ = snapshot.load_current;
+        return;
+    }
+    const StatusSnapshot& before = *previous_;
+    
+    const uint16_t modules_before = before.measurements.connected_modules;
+    const uint16_t modules_now = snapshot.measurements.connected_modules;
+    if (modules_before != modules_now) {
+        module_count_handlers_.notify(modules_before, modules_now);
+    }
+    
+    for (const auto& [bit, member] : global_status_bits) {
+        if (before.global_status.*member != snapshot.global_status.*member) {
+            global_status_handlers_.notify(bit, snapshot.global_status.*member);
+        }
+    }
+    
+    for (size_t i = 0; i < max_channels; ++i) {
+        const auto module_number = static_cast<uint8_t>(i / channels_per_module + 1);
+        const auto channel_number = static_cast<uint8_t>(i % channels_per_module + 1);
+        
+        for (const auto& [bit, member] : channel_status_bits) {
+            if (before.channel_status[i].*member != snapshot.channel_status[i].*member) {
+                channel_status_handlers_.notify(module_number, channel_number, bit, snapshot.channel_status[i].*member);
+            }
+        }
+        
+        // Compare against the last reported value so that slow drifts are reported eventually
+        const uint16_t reported = reported_load_current_[i];
+        const uint16_t current = snapshot.load_current[i];
+        const uint16_t difference = current > reported ? current - reported : reported - current;
+        if (difference > deadband_[i]) {
+            load_current_handlers_.notify(module_number, channel_number, reported, current);
+            reported_load_current_[i] = current;
+        }
+    }
+    
+    previous_ = snapshot;
+}
+
+void ChangePoller::reset() {
+    previous_.reset();
+}
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,187 @@
+#include "caparoc/event_loop.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <system_error>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+namespace {
+
+// Key of the internal wakeup descriptor in epoll_event::data
+constexpr uint64_t wake_key = 0;
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::system_category(), what);
+}
+
+} // namespace
+
+// ============================================================================
+// Event Loop
+// ============================================================================
+
+EventLoop::EventLoop() {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        throw_errno("epoll_create1");
+    }
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd_ < 0) {
+        close(epoll_fd_);
+        throw_errno("eventfd");
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = wake_key;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event);
+}
+
+EventLoop::~EventLoop() {
+    close(wake_fd_);
+    close(epoll_fd_);
+}
+
+void EventLoop::add_fd(int fd, uint32_t events, FdHandler handler) {
+    const uint64_t key = next_watch_++;
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = key;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+        throw_errno("epoll_ctl");
+    }
+    watches_[key] = std::make_shared<Watch>(Watch{fd, std::move(handler)});
+    watch_by_fd_[fd] = key;
+}
+
+void EventLoop::modify_fd(int fd, uint32_t events) {
+    auto it = watch_by_fd_.find(fd);
+    if (it == watch_by_fd_.end()) {
+        return;
+    }
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = it->second;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event);
+}
+
+void EventLoop::remove_fd(int fd) {
+    auto it = watch_by_fd_.find(fd);
+    if (it == watch_by_fd_.end()) {
+        return;
+    }
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    watches_.erase(it->second);
+    watch_by_fd_.erase(it);
+}
+
+EventLoop::TimerId EventLoop::add_timer(clock::time_point when, std::function<void()> fn) {
+    const TimerId id = next_timer_++;
+    timer_queue_.push({when, id});
+    timers_.emplace(id, std::move(fn));
+    return id;
+}
+
+void EventLoop::cancel_timer(TimerId id) {
+    // The queue entry is dropped lazily when it comes due
+    timers_.erase(id);
+}
+
+void EventLoop::post(std::function<void()> fn) {
+    {
+        std::lock_guard lock(posted_mutex_);
+        posted_.push_back(std::move(fn));
+    }
+    wake();
+}
+
+void EventLoop::wake() {
+    const uint64_t one = 1;
+    [[maybe_unused]] auto written = write(wake_fd_, &one, sizeof(one));
+}
+
+void EventLoop::run_once(std::chrono::milliseconds max_wait) {
+    auto wait = max_wait;
+    {
+        std::lock_guard lock(posted_mutex_);
+        if (!posted_.empty()) {
+            wait = std::chrono::milliseconds(0);
+        }
+    }
+    // Skip over cancelled timers to find the real deadline
+    while (!timer_queue_.empty() && !timers_.contains(timer_queue_.top().id)) {
+        timer_queue_.pop();
+    }
+    if (!timer_queue_.empty()) {
+        const auto until_timer = std::chrono::ceil<std::chrono::milliseconds>(timer_queue_.top().when - clock::now());
+        wait = std::clamp(until_timer, std::chrono::milliseconds(0), wait);
+    }
+    
+    std::array<epoll_event, 64> events;
+    const int count = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), static_cast<int>(wait.count()));
+    for (int i = 0; i < count; ++i) {
+        const uint64_t key = events[i].data.u64;
+        if (key == wake_key) {
+            uint64_t value;
+            [[maybe_unused]] auto drained = read(wake_fd_, &value, sizeof(value));
+            continue;
+        }
+        // A handler may remove itself or other descriptors, keep the watch alive while it runs
+        auto it = watches_.find(key);
+        if (it == watches_.end()) {
+            continue;
+        }
+        auto watch = it->second;
+        watch->handler(events[i].events);
+    }
+    
+    run_timers();
+    run_posted();
+}
+
+void EventLoop::run_timers() {
+    const auto now = clock::now();
+    while (!timer_queue_.empty() && timer_queue_.top().when <= now) {
+        const TimerId id = timer_queue_.top().id;
+        timer_queue_.pop();
+        auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            continue;
+        }
+        auto fn = std::move(it->second);
+        timers_.erase(it);
+        fn();
+    }
+}
+
+void EventLoop::run_posted() {
+    std::vector<std::function<void()>> posted;
+    {
+        std::lock_guard lock(posted_mutex_);
+        posted.swap(posted_);
+    }
+    for (auto& fn : posted) {
+        fn();
+    }
+}
+
+void EventLoop::run() {
+    // The flag is consumed on exit, so the loop can be run again afterwards
+    while (!stopped_.exchange(false)) {
+        run_once();
+    }
+}
+
+void EventLoop::stop() {
+    stopped_ = true;
+    wake();
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
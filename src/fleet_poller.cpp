@@ -0,0 +1,172 @@
+#include "caparoc/fleet_poller.hpp"
+#include "caparoc/read_planner.hpp"
+#include <algorithm>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+namespace {
+
+bool is_transport_error(std::error_code error) {
+    // Exception responses prove that the device is reachable, everything else does not
+    return error.category() != modbus_category() || error.value() >= static_cast<int>(ModbusErrc::not_connected);
+}
+
+} // namespace
+
+// ============================================================================
+// Fleet Polling
+// ============================================================================
+
+FleetPoller::FleetPoller(EventLoop& loop, FleetPollerOptions options)
+    : loop_(loop)
+    , options_(options) {
+}
+
+FleetPoller::~FleetPoller() {
+    stop();
+}
+
+size_t FleetPoller::add_device(std::string host, uint16_t port) {
+    auto device = std::make_unique<Device>();
+    device->index = devices_.size();
+    device->session = std::make_unique<ModbusTcpSession>(loop_, std::move(host), port, options_.session);
+    devices_.push_back(std::move(device));
+    
+    if (running_) {
+        auto& added = *devices_.back();
+        added.next_tick = EventLoop::clock::now();
+        added.tick_timer = loop_.add_timer(added.next_tick, [this, &added] { tick(added); });
+    }
+    return devices_.size() - 1;
+}
+
+void FleetPoller::start() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    
+    // Spread the devices evenly over one period
+    const auto now = EventLoop::clock::now();
+    const auto count = std::max<size_t>(devices_.size(), 1);
+    for (auto& device : devices_) {
+        device->next_tick = now + options_.period * device->index / count;
+        device->tick_timer = loop_.add_timer(device->next_tick, [this, &device = *device] { tick(device); });
+    }
+}
+
+void FleetPoller::stop() {
+    if (!running_) {
+        return;
+    }
+    // Clear the flag first, closing the sessions fails their pending requests
+    running_ = false;
+    for (auto& device : devices_) {
+        loop_.cancel_timer(device->tick_timer);
+        loop_.cancel_timer(device->backoff_timer);
+        device->session->close();
+        device->state = DeviceState::disconnected;
+    }
+    connecting_ = 0;
+}
+
+void FleetPoller::tick(Device& device) {
+    // Keep the grid of ticks fixed, so devices do not drift into each other
+    device.next_tick += options_.period;
+    const auto now = EventLoop::clock::now();
+    if (device.next_tick <= now) {
+        device.next_tick = now + options_.period;
+    }
+    device.tick_timer = loop_.add_timer(device.next_tick, [this, &device] { tick(device); });
+    
+    switch (device.state) {
+        case DeviceState::disconnected:
+            connect(device);
+            break;
+        case DeviceState::idle:
+            poll(device);
+            break;
+        case DeviceState::polling:
+            ++statistics_.overruns;
+            break;
+        case DeviceState::connecting:
+        case DeviceState::backoff:
+            break;
+    }
+}
+
+void FleetPoller::connect(Device& device) {
+    if (connecting_ >= options_.max_concurrent_connects) {
+        return;
+    }
+    ++connecting_;
+    ++statistics_.connects;
+    device.state = DeviceState::connecting;
+    device.session->connect([this, &device](std::error_code error) {
+        if (!running_) {
+            return;
+        }
+        --connecting_;
+        if (error) {
+            fail(device, error);
+            return;
+        }
+        device.state = DeviceState::idle;
+        poll(device);
+    });
+}
+
+void FleetPoller::poll(Device& device) {
+    const auto& requests = status_snapshot_read_plan().requests;
+    device.state = DeviceState::polling;
+    device.remaining = requests.size();
+    const uint64_t generation = ++device.generation;
+    
+    for (const auto& request : requests) {
+        device.session->read_registers(request.address, request.count,
+            [this, &device, generation, offset = request.address - status_block_address](std::error_code error, std::span<const uint16_t> values) {
+                if (!running_ || device.generation != generation) {
+                    return;
+                }
+                if (error) {
+                    ++device.generation;
+                    fail(device, error);
+                    return;
+                }
+                std::ranges::copy(values, device.block.begin() + offset);
+                if (--device.remaining > 0) {
+                    return;
+                }
+                device.state = DeviceState::idle;
+                ++statistics_.snapshots;
+                if (snapshot_handler_) {
+                    snapshot_handler_(device.index, decode_status_snapshot(device.block));
+                }
+            });
+    }
+}
+
+void FleetPoller::fail(Device& device, std::error_code error) {
+    ++statistics_.errors;
+    if (error_handler_) {
+        error_handler_(device.index, error);
+    }
+    
+    if (!is_transport_error(error)) {
+        device.state = DeviceState::idle;
+        return;
+    }
+    // Drop the connection: after a timeout the stream may still deliver stale responses
+    device.state = DeviceState::backoff;
+    device.session->close();
+    device.backoff_timer = loop_.add_timer(options_.reconnect_delay, [this, &device] {
+        device.backoff_timer = 0;
+        device.state = DeviceState::disconnected;
+    });
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
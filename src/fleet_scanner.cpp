@@ -0,0 +1,252 @@
+#include "caparoc/fleet_scanner.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Fleet Scanning
+// ============================================================================
+
+struct FleetScanner::Impl {
+    struct Device {
+        ConnectionFactory factory;
+        std::unique_ptr<libmodbus_cpp::ModbusConnection> conn;
+        DeviceTopology topology;
+        
+        std::mutex mutex;
+        std::deque<ScanJob> jobs;
+        bool scheduled = false;  // a token for this device is queued or running
+    };
+    
+    // Deque of device tokens; the owner pops from the back, thieves from the front
+    struct Worker {
+        std::mutex mutex;
+        std::deque<size_t> tokens;
+        std::thread thread;
+    };
+    
+    std::vector<std::unique_ptr<Device>> devices;
+    std::mutex devices_mutex;
+    std::vector<std::unique_ptr<Worker>> workers;
+    
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    size_t queued = 0;
+    bool stopping = false;
+    
+    std::mutex done_mutex;
+    std::condition_variable done;
+    size_t outstanding = 0;
+    
+    std::mutex result_mutex;
+    ResultHandler result_handler;
+    
+    Device& device(size_t index) {
+        std::lock_guard lock(devices_mutex);
+        return *devices.at(index);
+    }
+    
+    void schedule(size_t index, size_t worker) {
+        {
+            std::lock_guard lock(workers[worker]->mutex);
+            workers[worker]->tokens.push_back(index);
+        }
+        {
+            std::lock_guard lock(wake_mutex);
+            ++queued;
+        }
+        wake.notify_one();
+    }
+    
+    std::optional<size_t> take(size_t self) {
+        {
+            auto& own = *workers[self];
+            std::lock_guard lock(own.mutex);
+            if (!own.tokens.empty()) {
+                const size_t index = own.tokens.back();
+                own.tokens.pop_back();
+                return index;
+            }
+        }
+        for (size_t offset = 1; offset < workers.size(); ++offset) {
+            auto& victim = *workers[(self + offset) % workers.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.tokens.empty()) {
+                const size_t index = victim.tokens.front();
+                victim.tokens.pop_front();
+                return index;
+            }
+        }
+        return std::nullopt;
+    }
+    
+    void run(size_t self) {
+        while (true) {
+            {
+                std::unique_lock lock(wake_mutex);
+                wake.wait(lock, [this] { return queued > 0 || stopping; });
+                if (queued == 0) {
+                    return;
+                }
+                --queued;
+            }
+            // A token was counted, so some deque holds one; retry until it is found
+            std::optional<size_t> index;
+            while (!(index = take(self))) {
+                std::this_thread::yield();
+            }
+            execute(*index, self);
+        }
+    }
+    
+    void execute(size_t index, size_t self) {
+        Device& dev = device(index);
+        ScanJob job;
+        {
+            std::lock_guard lock(dev.mutex);
+            job = dev.jobs.front();
+            dev.jobs.pop_front();
+        }
+        
+        ScanResult result{index, job, std::monostate{}, {}};
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            if (!dev.conn) {
+                dev.conn = dev.factory();
+                dev.topology.invalidate();
+            }
+            if (dev.conn) {
+                switch (job) {
+                    case ScanJob::inventory:
+                        if (auto inventory = read_inventory(*dev.conn, dev.topology)) {
+                            result.data = std::move(*inventory);
+                        }
+                        break;
+                    case ScanJob::snapshot:
+                        if (auto snapshot = read_status_snapshot(*dev.conn)) {
+                            result.data = *snapshot;
+                        }
+                        break;
+                    case ScanJob::configuration:
+                        if (auto config = read_configuration(*dev.conn)) {
+                            result.data = *config;
+                        }
+                        break;
+                }
+            }
+        } catch (const std::exception&) {
+            // Reported as a failed job below
+        }
+        result.duration = std::chrono::steady_clock::now() - start;
+        if (!result.ok()) {
+            dev.conn.reset();
+        }
+        
+        {
+            std::lock_guard lock(result_mutex);
+            if (result_handler) {
+                result_handler(result);
+            }
+        }
+        
+        // Hand the device back to this worker if more jobs are waiting
+        bool more;
+        {
+            std::lock_guard lock(dev.mutex);
+            more = !dev.jobs.empty();
+            dev.scheduled = more;
+        }
+        if (more) {
+            schedule(index, self);
+        }
+        
+        std::lock_guard lock(done_mutex);
+        if (--outstanding == 0) {
+            done.notify_all();
+        }
+    }
+};
+
+FleetScanner::FleetScanner(size_t concurrency)
+    : impl_(std::make_unique<Impl>()) {
+    if (concurrency == 0) {
+        throw std::invalid_argument("Concurrency must be at least 1");
+    }
+    for (size_t i = 0; i < concurrency; ++i) {
+        impl_->workers.push_back(std::make_unique<Impl::Worker>());
+    }
+    for (size_t i = 0; i < concurrency; ++i) {
+        impl_->workers[i]->thread = std::thread([impl = impl_.get(), i] { impl->run(i); });
+    }
+}
+
+FleetScanner::~FleetScanner() {
+    wait();
+    {
+        std::lock_guard lock(impl_->wake_mutex);
+        impl_->stopping = true;
+    }
+    impl_->wake.notify_all();
+    for (auto& worker : impl_->workers) {
+        worker->thread.join();
+    }
+}
+
+size_t FleetScanner::add_device(ConnectionFactory factory) {
+    auto device = std::make_unique<Impl::Device>();
+    device->factory = std::move(factory);
+    std::lock_guard lock(impl_->devices_mutex);
+    impl_->devices.push_back(std::move(device));
+    return impl_->devices.size() - 1;
+}
+
+void FleetScanner::on_result(ResultHandler handler) {
+    std::lock_guard lock(impl_->result_mutex);
+    impl_->result_handler = std::move(handler);
+}
+
+void FleetScanner::submit(size_t device, ScanJob job) {
+    auto& dev = impl_->device(device);
+    {
+        std::lock_guard lock(impl_->done_mutex);
+        ++impl_->outstanding;
+    }
+    bool schedule;
+    {
+        std::lock_guard lock(dev.mutex);
+        dev.jobs.push_back(job);
+        schedule = !std::exchange(dev.scheduled, true);
+    }
+    if (schedule) {
+        // Affinity: a device starts on the same worker every time
+        impl_->schedule(device, device % impl_->workers.size());
+    }
+}
+
+void FleetScanner::submit_all(ScanJob job) {
+    for (size_t i = 0; i < device_count(); ++i) {
+        submit(i, job);
+    }
+}
+
+void FleetScanner::wait() {
+    std::unique_lock lock(impl_->done_mutex);
+    impl_->done.wait(lock, [this] { return impl_->outstanding == 0; });
+}
+
+size_t FleetScanner::device_count() const {
+    std::lock_guard lock(impl_->devices_mutex);
+    return impl_->devices.size();
+}
+
+} // namespace v1
+} // namespace caparoc
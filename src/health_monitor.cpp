@@ -0,0 +1,78 @@
+#include "caparoc/health_monitor.hpp"
+#include <algorithm>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Health Monitoring
+// ============================================================================
+
+HealthMonitor::HealthMonitor(HealthMonitorOptions options)
+    : options_(options) {
+}
+
+std::optional<HealthReport> HealthMonitor::poll(libmodbus_cpp::ModbusConnection& conn, clock::time_point now) {
+    std::array<uint16_t, 1 + system_measurements_size> head{};
+    if (!read_registers(conn, 0x6000, head)) {
+        return std::nullopt;
+    }
+    
+    HealthReport report = report_;
+    report.global_status = decode_global_status(head[0]);
+    report.measurements = decode_system_measurements(std::span(head).subspan<1, system_measurements_size>());
+    report.channel_status_updated = false;
+    report.load_current_updated = false;
+    
+    // Only the slots of connected modules are transferred
+    const size_t channels = std::min<size_t>(report.measurements.connected_modules, max_modules) * channels_per_module;
+    std::array<uint16_t, max_channels> buffer{};
+    auto block = std::span(buffer).first(channels);
+    
+    const auto& status = report.global_status;
+    const bool drill_down = status.cumulative_channel_error || status.cumulative_80_warning;
+    const bool flipped = !initialized_ ||
+        status.cumulative_channel_error != report_.global_status.cumulative_channel_error ||
+        status.cumulative_80_warning != report_.global_status.cumulative_80_warning;
+    const bool refresh_due = options_.channel_status_refresh.count() > 0 &&
+        now - last_channel_status_read_ >= options_.channel_status_refresh;
+    
+    if (!drill_down) {
+        report.channel_status = {};
+    } else if (flipped || refresh_due) {
+        if (channels > 0 && !read_registers(conn, 0x6010, block)) {
+            return std::nullopt;
+        }
+        report.channel_status = {};
+        for (size_t i = 0; i < channels; ++i) {
+            report.channel_status[i] = decode_channel_status(block[i]);
+        }
+        report.channel_status_updated = true;
+        last_channel_status_read_ = now;
+    }
+    
+    if (status.cumulative_80_warning || status.system_current_too_high) {
+        if (channels > 0 && !read_registers(conn, 0x6050, block)) {
+            return std::nullopt;
+        }
+        report.load_current = {};
+        std::ranges::copy(block, report.load_current.begin());
+        report.load_current_valid = true;
+        report.load_current_updated = true;
+    } else {
+        report.load_current_valid = false;
+    }
+    
+    report_ = report;
+    initialized_ = true;
+    return report_;
+}
+
+void HealthMonitor::reset() {
+    report_ = {};
+    initialized_ = false;
+    last_channel_status_read_ = {};
+}
+
+} // namespace v1
+} // namespace caparoc
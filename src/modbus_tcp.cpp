@@ -0,0 +1,173 @@
+#include "caparoc/modbus_tcp.hpp"
+#include "caparoc/caparoc.hpp"
+#include <stdexcept>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+namespace {
+
+// MODBUS is big endian on the wire
+void put_u16(Frame& frame, uint16_t value) {
+    frame.data[frame.size++] = static_cast<uint8_t>(value >> 8);
+    frame.data[frame.size++] = static_cast<uint8_t>(value & 0xFF);
+}
+
+uint16_t get_u16(std::span<const uint8_t> bytes, size_t offset) {
+    return static_cast<uint16_t>((bytes[offset] << 8) | bytes[offset + 1]);
+}
+
+Frame begin_frame(uint16_t transaction_id, uint8_t unit_id, FunctionCode function) {
+    Frame frame;
+    put_u16(frame, transaction_id);
+    put_u16(frame, 0);  // protocol id
+    put_u16(frame, 0);  // length, patched by finish_frame
+    frame.data[frame.size++] = unit_id;
+    frame.data[frame.size++] = static_cast<uint8_t>(function);
+    return frame;
+}
+
+Frame finish_frame(Frame frame) {
+    // The length field counts the unit id and the PDU
+    const auto length = static_cast<uint16_t>(frame.size - 6);
+    frame.data[4] = static_cast<uint8_t>(length >> 8);
+    frame.data[5] = static_cast<uint8_t>(length & 0xFF);
+    return frame;
+}
+
+class ModbusCategory : public std::error_category {
+public:
+    const char* name() const noexcept override { return "modbus"; }
+
+    std::string message(int value) const override {
+        switch (static_cast<ModbusErrc>(value)) {
+            case ModbusErrc::illegal_function: return "Illegal function";
+            case ModbusErrc::illegal_data_address: return "Illegal data address";
+            case ModbusErrc::illegal_data_value: return "Illegal data value";
+            case ModbusErrc::server_device_failure: return "Server device failure";
+            case ModbusErrc::acknowledge: return "Acknowledge";
+            case ModbusErrc::server_device_busy: return "Server device busy";
+            case ModbusErrc::memory_parity_error: return "Memory parity error";
+            case ModbusErrc::gateway_path_unavailable: return "Gateway path unavailable";
+            case ModbusErrc::gateway_target_failed: return "Gateway target device failed to respond";
+            case ModbusErrc::not_connected: return "Not connected";
+            case ModbusErrc::timeout: return "Request timed out";
+            case ModbusErrc::connection_closed: return "Connection closed";
+            case ModbusErrc::protocol_error: return "Malformed response";
+            case ModbusErrc::cancelled: return "Request cancelled";
+        }
+        return "Unknown MODBUS error " + std::to_string(value);
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// MODBUS/TCP Framing
+// ============================================================================
+
+Frame encode_read_holding_registers(uint16_t transaction_id, uint8_t unit_id, uint16_t address, uint16_t count) {
+    if (count == 0 || count > max_read_registers) {
+        throw std::invalid_argument("Register count must be between 1 and 125");
+    }
+    Frame frame = begin_frame(transaction_id, unit_id, FunctionCode::read_holding_registers);
+    put_u16(frame, address);
+    put_u16(frame, count);
+    return finish_frame(frame);
+}
+
+Frame encode_write_single_register(uint16_t transaction_id, uint8_t unit_id, uint16_t address, uint16_t value) {
+    Frame frame = begin_frame(transaction_id, unit_id, FunctionCode::write_single_register);
+    put_u16(frame, address);
+    put_u16(frame, value);
+    return finish_frame(frame);
+}
+
+Frame encode_write_multiple_registers(uint16_t transaction_id, uint8_t unit_id, uint16_t address, std::span<const uint16_t> values) {
+    if (values.empty() || values.size() > max_write_registers) {
+        throw std::invalid_argument("Register count must be between 1 and 123");
+    }
+    Frame frame = begin_frame(transaction_id, unit_id, FunctionCode::write_multiple_registers);
+    put_u16(frame, address);
+    put_u16(frame, static_cast<uint16_t>(values.size()));
+    frame.data[frame.size++] = static_cast<uint8_t>(values.size() * 2);
+    for (uint16_t value : values) {
+        put_u16(frame, value);
+    }
+    return finish_frame(frame);
+}
+
+std::optional<size_t> frame_size(std::span<const uint8_t> buffer) {
+    if (buffer.size() < mbap_header_size) {
+        return 0;
+    }
+    const uint16_t protocol = get_u16(buffer, 2);
+    const uint16_t length = get_u16(buffer, 4);
+    // The length covers at least unit id and function code
+    if (protocol != 0 || length < 2 || length + 6u > max_adu_size) {
+        return std::nullopt;
+    }
+    const size_t size = 6 + length;
+    return buffer.size() >= size ? size : 0;
+}
+
+std::optional<Response> parse_response(std::span<const uint8_t> adu) {
+    auto size = frame_size(adu);
+    if (!size || *size == 0 || *size != adu.size()) {
+        return std::nullopt;
+    }
+
+    Response response;
+    response.transaction_id = get_u16(adu, 0);
+    response.unit_id = adu[6];
+    const uint8_t function = adu[7];
+    response.function = function & 0x7F;
+    response.payload = adu.subspan(8);
+    response.exception_code = 0;
+    if (function & 0x80) {
+        if (response.payload.size() != 1) {
+            return std::nullopt;
+        }
+        response.exception_code = response.payload[0];
+    }
+    return response;
+}
+
+bool decode_read_response(const Response& response, std::span<uint16_t> values) {
+    const auto& payload = response.payload;
+    if (response.exception_code != 0 ||
+        response.function != static_cast<uint8_t>(FunctionCode::read_holding_registers) ||
+        payload.empty() || payload[0] != values.size() * 2 || payload.size() != 1 + values.size() * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = get_u16(payload, 1 + 2 * i);
+    }
+    return true;
+}
+
+bool check_write_response(const Response& response, uint16_t address, uint16_t value) {
+    const bool write_function =
+        response.function == static_cast<uint8_t>(FunctionCode::write_single_register) ||
+        response.function == static_cast<uint8_t>(FunctionCode::write_multiple_registers);
+    return response.exception_code == 0 && write_function && response.payload.size() == 4 &&
+        get_u16(response.payload, 0) == address && get_u16(response.payload, 2) == value;
+}
+
+// ============================================================================
+// Errors
+// ============================================================================
+
+const std::error_category& modbus_category() noexcept {
+    static const ModbusCategory category;
+    return category;
+}
+
+std::error_code make_error_code(ModbusErrc errc) noexcept {
+    return {static_cast<int>(errc), modbus_category()};
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,371 @@
+#include "caparoc/modbus_tcp_session.hpp"
+#include "caparoc/caparoc.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <iterator>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+namespace caparoc {
+inline namespace v1 {
+namespace async {
+
+// ============================================================================
+// Non-Blocking MODBUS/TCP Session
+// ============================================================================
+
+ModbusTcpSession::ModbusTcpSession(EventLoop& loop, std::string host, uint16_t port, SessionOptions options)
+    : loop_(loop)
+    , host_(std::move(host))
+    , port_(port)
+    , options_(options) {
+}
+
+ModbusTcpSession::~ModbusTcpSession() {
+    connect_callback_ = nullptr;
+    queue_.clear();
+    for (const auto& pending : in_flight_) {
+        loop_.cancel_timer(pending.timer);
+    }
+    in_flight_.clear();
+    loop_.cancel_timer(connect_timer_);
+    loop_.cancel_timer(failure_timer_);
+    if (fd_ >= 0) {
+        loop_.remove_fd(fd_);
+        ::close(fd_);
+    }
+}
+
+void ModbusTcpSession::connect(ConnectCallback callback) {
+    if (state_ != State::disconnected) {
+        loop_.post([callback = std::move(callback), connected = state_ == State::connected] {
+            callback(connected ? std::error_code{} : make_error_code(ModbusErrc::cancelled));
+        });
+        return;
+    }
+    
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* result = nullptr;
+    const auto service = std::to_string(port_);
+    if (getaddrinfo(host_.c_str(), service.c_str(), &hints, &result) != 0 || !result) {
+        loop_.post([callback = std::move(callback)] {
+            callback(std::make_error_code(std::errc::host_unreachable));
+        });
+        return;
+    }
+    
+    fd_ = socket(result->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    const int rc = fd_ >= 0 ? ::connect(fd_, result->ai_addr, result->ai_addrlen) : -1;
+    const int error = errno;
+    freeaddrinfo(result);
+    if (fd_ < 0 || (rc < 0 && error != EINPROGRESS)) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        loop_.post([callback = std::move(callback), error] {
+            callback(std::error_code(error, std::system_category()));
+        });
+        return;
+    }
+    
+    const int one = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    
+    state_ = State::connecting;
+    connect_callback_ = std::move(callback);
+    loop_.add_fd(fd_, EPOLLOUT, [this](uint32_t events) { on_events(events); });
+    connect_timer_ = loop_.add_timer(options_.connect_timeout, [this] {
+        connect_timer_ = 0;
+        disconnect(make_error_code(ModbusErrc::timeout));
+    });
+}
+
+void ModbusTcpSession::close() {
+    disconnect(make_error_code(ModbusErrc::cancelled));
+}
+
+void ModbusTcpSession::read_registers(uint16_t address, uint16_t count, ReadCallback callback) {
+    if (count == 0 || count > max_read_registers) {
+        fail_later(std::move(callback), make_error_code(ModbusErrc::illegal_data_value));
+        return;
+    }
+    const uint16_t id = next_transaction_id_++;
+    enqueue(FunctionCode::read_holding_registers, address, count,
+        encode_read_holding_registers(id, options_.unit_id, address, count), std::move(callback));
+}
+
+void ModbusTcpSession::write_register(uint16_t address, uint16_t value, WriteCallback callback) {
+    const uint16_t id = next_transaction_id_++;
+    enqueue(FunctionCode::write_single_register, address, value,
+        encode_write_single_register(id, options_.unit_id, address, value),
+        [callback = std::move(callback)](std::error_code error, std::span<const uint16_t>) { callback(error); });
+}
+
+void ModbusTcpSession::write_registers(uint16_t address, std::span<const uint16_t> values, WriteCallback callback) {
+    auto done = [callback = std::move(callback)](std::error_code error, std::span<const uint16_t>) { callback(error); };
+    if (values.empty() || values.size() > max_write_registers) {
+        fail_later(std::move(done), make_error_code(ModbusErrc::illegal_data_value));
+        return;
+    }
+    const uint16_t id = next_transaction_id_++;
+    enqueue(FunctionCode::write_multiple_registers, address, static_cast<uint16_t>(values.size()),
+        encode_write_multiple_registers(id, options_.unit_id, address, values), std::move(done));
+}
+
+void ModbusTcpSession::enqueue(FunctionCode function, uint16_t address, uint16_t expected, Frame frame, ReadCallback callback) {
+    if (state_ == State::disconnected) {
+        fail_later(std::move(callback), make_error_code(ModbusErrc::not_connected));
+        return;
+    }
+    // The transaction id is the first field of the frame
+    const auto id = static_cast<uint16_t>((frame.data[0] << 8) | frame.data[1]);
+    queue_.push_back(Pending{id, function, address, expected, frame, std::move(callback)});
+    if (state_ == State::connected) {
+        send_next();
+    }
+}
+
+void ModbusTcpSession::fail_later(ReadCallback callback, std::error_code error) {
+    loop_.post([callback = std::move(callback), error] { callback(error, {}); });
+}
+
+void ModbusTcpSession::fail_connection_later(std::error_code error) {
+    loop_.modify_fd(fd_, EPOLLIN);
+    failure_timer_ = loop_.add_timer(EventLoop::clock::duration::zero(), [this, error] {
+        failure_timer_ = 0;
+        disconnect(error);
+    });
+}
+
+void ModbusTcpSession::on_events(uint32_t events) {
+    if (state_ == State::connecting) {
+        int error = 0;
+        socklen_t length = sizeof(error);
+        getsockopt(fd_, SOL_SOCKET, SO_ERROR, &error, &length);
+        if (error != 0 || (events & (EPOLLERR | EPOLLHUP))) {
+            disconnect(std::error_code(error != 0 ? error : ECONNREFUSED, std::system_category()));
+            return;
+        }
+        on_connected();
+        return;
+    }
+    
+    if (events & EPOLLIN) {
+        on_readable();
+        if (state_ != State::connected) {
+            return;
+        }
+    }
+    if (events & (EPOLLERR | EPOLLHUP)) {
+        disconnect(make_error_code(ModbusErrc::connection_closed));
+        return;
+    }
+    if (events & EPOLLOUT) {
+        flush();
+    }
+}
+
+void ModbusTcpSession::on_connected() {
+    state_ = State::connected;
+    // A fallback on the previous connection may have been caused by a network problem
+    pipelining_ = true;
+    loop_.cancel_timer(connect_timer_);
+    connect_timer_ = 0;
+    loop_.modify_fd(fd_, EPOLLIN);
+    if (auto callback = std::exchange(connect_callback_, nullptr)) {
+        callback({});
+    }
+    if (state_ == State::connected) {
+        send_next();
+    }
+}
+
+void ModbusTcpSession::on_readable() {
+    std::array<uint8_t, 4096> buffer;
+    while (true) {
+        const ssize_t received = recv(fd_, buffer.data(), buffer.size(), 0);
+        if (received > 0) {
+            in_.insert(in_.end(), buffer.begin(), buffer.begin() + received);
+            continue;
+        }
+        if (received == 0) {
+            disconnect(make_error_code(ModbusErrc::connection_closed));
+            return;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        }
+        if (errno != EINTR) {
+            disconnect(std::error_code(errno, std::system_category()));
+            return;
+        }
+    }
+    
+    while (state_ == State::connected) {
+        auto size = frame_size(in_);
+        if (!size) {
+            // The stream cannot be resynchronised after a malformed header
+            disconnect(make_error_code(ModbusErrc::protocol_error));
+            return;
+        }
+        if (*size == 0) {
+            break;
+        }
+        std::array<uint8_t, max_adu_size> adu;
+        std::copy_n(in_.begin(), *size, adu.begin());
+        in_.erase(in_.begin(), in_.begin() + static_cast<std::ptrdiff_t>(*size));
+        if (auto response = parse_response(std::span(adu).first(*size))) {
+            on_response(*response);
+        }
+    }
+}
+
+void ModbusTcpSession::on_response(const Response& response) {
+    auto it = std::ranges::find(in_flight_, response.transaction_id, &Pending::transaction_id);
+    if (it == in_flight_.end()) {
+        // Late responses of timed out requests carry an unknown transaction id. While
+        // pipelining this may also mean that the device mixes up requests.
+        disable_pipelining();
+        return;
+    }
+    Pending pending = std::move(*it);
+    in_flight_.erase(it);
+    loop_.cancel_timer(pending.timer);
+    if (!pipelining_ && options_.pipelining_retry_after != 0 && ++clean_responses_ >= options_.pipelining_retry_after) {
+        pipelining_ = true;
+    }
+    
+    std::array<uint16_t, max_read_registers> values{};
+    std::span<uint16_t> result;
+    std::error_code error;
+    if (response.exception_code != 0) {
+        error = make_error_code(static_cast<ModbusErrc>(response.exception_code));
+    } else if (response.function != static_cast<uint8_t>(pending.function)) {
+        error = make_error_code(ModbusErrc::protocol_error);
+    } else if (pending.function == FunctionCode::read_holding_registers) {
+        result = std::span(values).first(pending.expected);
+        if (!decode_read_response(response, result)) {
+            error = make_error_code(ModbusErrc::protocol_error);
+        }
+    } else if (!check_write_response(response, pending.address, pending.expected)) {
+        error = make_error_code(ModbusErrc::protocol_error);
+    }
+    
+    complete(std::move(pending), error, error ? std::span<const uint16_t>{} : result);
+    send_next();
+}
+
+void ModbusTcpSession::on_timeout(uint16_t transaction_id) {
+    auto it = std::ranges::find(in_flight_, transaction_id, &Pending::transaction_id);
+    if (it == in_flight_.end()) {
+        return;
+    }
+    Pending pending = std::move(*it);
+    in_flight_.erase(it);
+    // Devices that cannot pipeline typically drop the requests they are not ready for
+    disable_pipelining();
+    complete(std::move(pending), make_error_code(ModbusErrc::timeout), {});
+    send_next();
+}
+
+void ModbusTcpSession::disable_pipelining() {
+    pipelining_ = false;
+    clean_responses_ = 0;
+}
+
+void ModbusTcpSession::send_next() {
+    if (state_ != State::connected) {
+        return;
+    }
+    // Fill the window and send all new frames with one flush
+    bool added = false;
+    while (!queue_.empty() && in_flight_.size() < window()) {
+        Pending& pending = in_flight_.emplace_back(std::move(queue_.front()));
+        queue_.pop_front();
+        
+        const uint16_t id = pending.transaction_id;
+        pending.timer = loop_.add_timer(options_.request_timeout, [this, id] { on_timeout(id); });
+        auto bytes = pending.frame.bytes();
+        out_.insert(out_.end(), bytes.begin(), bytes.end());
+        added = true;
+    }
+    if (added) {
+        flush();
+    }
+}
+
+void ModbusTcpSession::flush() {
+    if (failure_timer_ != 0) {
+        return;
+    }
+    while (!out_.empty()) {
+        const ssize_t sent = send(fd_, out_.data(), out_.size(), MSG_NOSIGNAL);
+        if (sent > 0) {
+            out_.erase(out_.begin(), out_.begin() + sent);
+            continue;
+        }
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            loop_.modify_fd(fd_, EPOLLIN | EPOLLOUT);
+            return;
+        }
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        // flush() may run within read_registers() and friends, whose callbacks must not run before they return
+        fail_connection_later(make_error_code(ModbusErrc::connection_closed));
+        return;
+    }
+    loop_.modify_fd(fd_, EPOLLIN);
+}
+
+void ModbusTcpSession::complete(Pending pending, std::error_code error, std::span<const uint16_t> values) {
+    if (pending.callback) {
+        pending.callback(error, values);
+    }
+}
+
+void ModbusTcpSession::disconnect(std::error_code error) {
+    if (state_ == State::disconnected) {
+        return;
+    }
+    state_ = State::disconnected;
+    loop_.cancel_timer(connect_timer_);
+    connect_timer_ = 0;
+    loop_.cancel_timer(failure_timer_);
+    failure_timer_ = 0;
+    loop_.remove_fd(fd_);
+    ::close(fd_);
+    fd_ = -1;
+    out_.clear();
+    in_.clear();
+    
+    // Detach everything first, callbacks may reconnect or issue new requests
+    auto connect_callback = std::exchange(connect_callback_, nullptr);
+    std::deque<Pending> failed = std::move(in_flight_);
+    in_flight_.clear();
+    for (const auto& pending : failed) {
+        loop_.cancel_timer(pending.timer);
+    }
+    std::ranges::move(queue_, std::back_inserter(failed));
+    queue_.clear();
+    
+    if (connect_callback) {
+        connect_callback(error);
+    }
+    for (auto& pending : failed) {
+        complete(std::move(pending), error, {});
+    }
+}
+
+} // namespace async
+} // namespace v1
+} // namespace caparoc
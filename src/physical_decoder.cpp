@@ -0,0 +1,116 @@
+#include "caparoc/physical_decoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <stdexcept>
+
+namespace caparoc {
+inline namespace v1 {
+
+namespace {
+
+// Scale or offset in units of 1 / fixed_point_scale, clears ok if that is not a whole number
+int64_t fixed_factor(float value, int32_t fixed_point_scale, bool& ok) {
+    const double scaled = static_cast<double>(value) * fixed_point_scale;
+    const double rounded = std::round(scaled);
+    // Table values are stored as float, so allow for its rounding error
+    ok = ok && std::abs(scaled - rounded) <= 1e-4 * std::max(1.0, std::abs(rounded));
+    return static_cast<int64_t>(rounded);
+}
+
+} // namespace
+
+// ============================================================================
+// Physical Decoder
+// ============================================================================
+
+PhysicalDecoder::PhysicalDecoder(uint16_t address, uint16_t count, int32_t fixed_point_scale)
+    : address_(address)
+    , count_(count)
+    , fixed_point_scale_(fixed_point_scale) {
+    if (count == 0 || address + count > 0x10000) {
+        throw std::invalid_argument(std::format("Invalid register block 0x{:04X}+{}", address, count));
+    }
+    if (fixed_point_scale <= 0) {
+        throw std::invalid_argument("Fixed point scale must be positive");
+    }
+
+    // Words without a single-word register keep their raw value in both outputs
+    sign_.assign(count, 0);
+    scale_.assign(count, 1.0f);
+    offset_.assign(count, 0.0f);
+    fixed_scale_.assign(count, 1);
+    fixed_offset_.assign(count, 0);
+
+    for (uint16_t i = 0; i < count; ++i) {
+        const uint16_t word_address = static_cast<uint16_t>(address + i);
+        const RegisterInfo* info = find_register_info(word_address);
+        if (!info || info->num_registers != 1 ||
+            (info->type != RegisterType::UINT16 && info->type != RegisterType::INT16)) {
+            continue;
+        }
+
+        sign_[i] = info->type == RegisterType::INT16 ? 0x8000 : 0;
+        scale_[i] = info->scale;
+        offset_[i] = info->offset;
+
+        bool ok = true;
+        const int64_t factor = fixed_factor(info->scale, fixed_point_scale, ok);
+        const int64_t offset = fixed_factor(info->offset, fixed_point_scale, ok);
+        const int64_t low = (sign_[i] ? -32768 : 0) * factor + offset;
+        const int64_t high = (sign_[i] ? 32767 : 65535) * factor + offset;
+        if (!ok || std::min(low, high) < std::numeric_limits<int32_t>::min() ||
+            std::max(low, high) > std::numeric_limits<int32_t>::max()) {
+            throw std::invalid_argument(std::format(
+                "Register 0x{:04X} cannot be represented with a fixed point scale of {}", word_address, fixed_point_scale));
+        }
+        fixed_scale_[i] = static_cast<int32_t>(factor);
+        fixed_offset_[i] = static_cast<int32_t>(offset);
+    }
+}
+
+PhysicalDecoder::PhysicalDecoder(const RegisterFamily& family, int32_t fixed_point_scale)
+    : PhysicalDecoder(family.base, family.span(), fixed_point_scale) {
+}
+
+void PhysicalDecoder::check_sizes(size_t raw_size, size_t out_size) const {
+    if (raw_size % count_ != 0 || out_size != raw_size) {
+        throw std::invalid_argument(std::format(
+            "Expected whole samples of {} registers and an output of the same size, got {} and {}", count_, raw_size, out_size));
+    }
+}
+
+void PhysicalDecoder::decode(std::span<const uint16_t> raw, std::span<float> out) const {
+    check_sizes(raw.size(), out.size());
+    const uint16_t* sign = sign_.data();
+    const float* scale = scale_.data();
+    const float* offset = offset_.data();
+    for (size_t sample = 0; sample < raw.size(); sample += count_) {
+        const uint16_t* in = raw.data() + sample;
+        float* result = out.data() + sample;
+        for (size_t i = 0; i < count_; ++i) {
+            // (w ^ 0x8000) - 0x8000 sign-extends INT16 words without a branch
+            const int32_t value = static_cast<int32_t>(in[i] ^ sign[i]) - sign[i];
+            result[i] = static_cast<float>(value) * scale[i] + offset[i];
+        }
+    }
+}
+
+void PhysicalDecoder::decode(std::span<const uint16_t> raw, std::span<int32_t> out) const {
+    check_sizes(raw.size(), out.size());
+    const uint16_t* sign = sign_.data();
+    const int32_t* scale = fixed_scale_.data();
+    const int32_t* offset = fixed_offset_.data();
+    for (size_t sample = 0; sample < raw.size(); sample += count_) {
+        const uint16_t* in = raw.data() + sample;
+        int32_t* result = out.data() + sample;
+        for (size_t i = 0; i < count_; ++i) {
+            const int32_t value = static_cast<int32_t>(in[i] ^ sign[i]) - sign[i];
+            result[i] = value * scale[i] + offset[i];
+        }
+    }
+}
+
+} // namespace v1
+} // namespace caparoc
@@ -0,0 +1,169 @@
+#include "caparoc/poll_scheduler.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace caparoc {
+inline namespace v1 {
+
+namespace {
+
+bool is_quint_register(uint16_t address) {
+    return (address >= 0x7000 && address < 0x7100) || (address >= 0xD000 && address < 0xD100);
+}
+
+} // namespace
+
+// ============================================================================
+// Multi-Rate Polling
+// ============================================================================
+
+size_t PollScheduler::add_group(std::vector<ReadRequest> ranges, std::chrono::milliseconds period, Handler handler) {
+    Group group;
+    group.handle = next_handle_++;
+    group.quint = std::ranges::any_of(ranges, [](const ReadRequest& range) { return is_quint_register(range.address); });
+    group.ranges = std::move(ranges);
+    group.period = period;
+    group.next_due = clock::time_point::min();
+    group.handler = std::move(handler);
+    update_effective_period(group);
+    groups_.push_back(std::move(group));
+    return groups_.back().handle;
+}
+
+size_t PollScheduler::add_group(std::vector<ReadRequest> ranges, RateClass rate, Handler handler) {
+    return add_group(std::move(ranges), rate_class_period(rate), std::move(handler));
+}
+
+void PollScheduler::remove_group(size_t group) {
+    std::erase_if(groups_, [group](const Group& entry) { return entry.handle == group; });
+}
+
+void PollScheduler::on_error(ErrorHandler handler) {
+    error_handlers_.push_back(std::move(handler));
+}
+
+bool PollScheduler::update_bus_cycles(libmodbus_cpp::ModbusConnection& conn) {
+    std::array<uint16_t, 2> values{};
+    if (!read_registers(conn, 0x6006, values)) {
+        return false;
+    }
+    set_bus_cycles(std::chrono::milliseconds(values[0]), std::chrono::milliseconds(values[1]));
+    return true;
+}
+
+void PollScheduler::set_bus_cycles(std::chrono::milliseconds caparoc_bus_cycle, std::chrono::milliseconds quint_bus_cycle) {
+    caparoc_bus_cycle_ = caparoc_bus_cycle;
+    quint_bus_cycle_ = quint_bus_cycle;
+    for (auto& group : groups_) {
+        update_effective_period(group);
+    }
+}
+
+void PollScheduler::update_effective_period(Group& group) const {
+    // One-shot groups stay one-shot, periodic ones never poll faster than the device refreshes
+    if (group.period.count() == 0) {
+        group.effective_period = group.period;
+        return;
+    }
+    group.effective_period = std::max(group.period, group.quint ? quint_bus_cycle_ : caparoc_bus_cycle_);
+}
+
+PollScheduler::clock::time_point PollScheduler::next_due() const {
+    auto next = clock::time_point::max();
+    for (const auto& group : groups_) {
+        next = std::min(next, group.next_due);
+    }
+    return next;
+}
+
+PollScheduler::clock::time_point PollScheduler::run_due(libmodbus_cpp::ModbusConnection& conn, clock::time_point now) {
+    // Collect everything due now or shortly after, so it shares the block reads
+    std::vector<size_t> due;
+    std::vector<ReadRequest> ranges;
+    for (const auto& group : groups_) {
+        if (group.next_due <= now + merge_window_) {
+            due.push_back(group.handle);
+            ranges.insert(ranges.end(), group.ranges.begin(), group.ranges.end());
+        }
+    }
+    if (due.empty()) {
+        return next_due();
+    }
+    
+    // Execute request by request so that one failure does not discard the other groups
+    RegisterValues values;
+    std::array<uint16_t, max_read_registers> buffer{};
+    for (const auto& request : plan_reads(std::span<const ReadRequest>(ranges), plan_options_).requests) {
+        auto block = std::span(buffer).first(request.count);
+        if (read_registers(conn, request.address, block)) {
+            values.assign(request.address, block);
+        }
+    }
+    
+    // Handlers may add or remove groups, so groups are looked up by handle after every call
+    for (size_t handle : due) {
+        Group* group = find_group(handle);
+        if (!group) {
+            continue;
+        }
+        const bool complete = std::ranges::all_of(group->ranges, [&values](const ReadRequest& range) {
+            return values.contains(range.address, range.count);
+        });
+        if (complete) {
+            const Handler handler = group->handler;
+            handler(values);
+        } else {
+            const auto error_handlers = error_handlers_;
+            for (const auto& handler : error_handlers) {
+                handler(handle);
+            }
+        }
+        
+        group = find_group(handle);
+        if (!group) {
+            continue;
+        }
+        if (group->effective_period.count() == 0) {
+            if (complete) {
+                remove_group(handle);
+            } else {
+                // Retry, but never faster than the device refreshes
+                group->next_due = now + std::max(retry_delay_, group->quint ? quint_bus_cycle_ : caparoc_bus_cycle_);
+            }
+            continue;
+        }
+        // Keep the cadence, but do not build up a backlog after stalls
+        group->next_due = group->next_due == clock::time_point::min() ? now : group->next_due;
+        group->next_due += group->effective_period;
+        if (group->next_due <= now) {
+            group->next_due = now + group->effective_period;
+        }
+    }
+    
+    return next_due();
+}
+
+PollScheduler::Group* PollScheduler::find_group(size_t handle) {
+    auto it = std::ranges::find(groups_, handle, &Group::handle);
+    return it != groups_.end() ? &*it : nullptr;
+}
+
+void PollScheduler::run(libmodbus_cpp::ModbusConnection& conn, std::stop_token stop) {
+    update_bus_cycles(conn);
+    
+    std::mutex mutex;
+    std::condition_variable_any wakeup;
+    while (!stop.stop_requested()) {
+        const auto next = run_due(conn);
+        std::unique_lock lock(mutex);
+        if (next == clock::time_point::max()) {
+            wakeup.wait(lock, stop, [] { return false; });
+        } else {
+            wakeup.wait_until(lock, stop, next, [] { return false; });
+        }
+    }
+}
+
+} // namespace v1
+} // namespace caparoc
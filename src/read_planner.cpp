@@ -0,0 +1,328 @@
+#include "caparoc/read_planner.hpp"
+#include <algorithm>
+#include <bit>
+#include <bitset>
+#include <format>
+#include <stdexcept>
+
+namespace caparoc {
+inline namespace v1 {
+
+namespace {
+
+// A range that must be read as a whole
+struct Unit {
+    uint32_t address;
+    uint32_t count;
+};
+
+const std::bitset<0x10000>& readable_addresses() {
+    static const auto readable = [] {
+        std::bitset<0x10000> bits;
+        for (size_t i = 0; i < register_table_size; ++i) {
+            const auto& reg = register_table[i];
+            if (reg.access == RegisterAccess::WRITE_ONLY) {
+                continue;
+            }
+            for (uint32_t offset = 0; offset < reg.num_registers; ++offset) {
+                const uint32_t address = reg.address + offset;
+                if (address < bits.size()) {
+                    bits.set(address);
+                }
+            }
+        }
+        return bits;
+    }();
+    return readable;
+}
+
+bool range_readable(uint32_t begin, uint32_t end) {
+    const auto& readable = readable_addresses();
+    for (uint32_t address = begin; address < end; ++address) {
+        if (!readable.test(address)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One unit per member of the modules [first_module, last_module] of a family
+std::vector<Unit> family_units(const RegisterFamily& family, uint8_t first_module, uint8_t last_module) {
+    std::vector<Unit> units;
+    for (uint8_t module = first_module; module <= last_module; ++module) {
+        for (uint8_t channel = 1; channel <= family.channels; ++channel) {
+            units.push_back({family.address(module, channel), family.num_registers});
+        }
+    }
+    return units;
+}
+
+ReadPlan plan_units(std::vector<Unit> units, const ReadPlanOptions& options) {
+    ReadPlan plan;
+    if (units.empty()) {
+        return plan;
+    }
+
+    const uint32_t max_count = std::clamp<uint32_t>(options.max_registers_per_request, 1, max_read_registers);
+
+    // Sort and join overlapping units, the union of atomic units is atomic
+    std::ranges::sort(units, {}, &Unit::address);
+    std::vector<Unit> merged;
+    merged.reserve(units.size());
+    for (const auto& unit : units) {
+        if (!merged.empty() && unit.address < merged.back().address + merged.back().count) {
+            auto& last = merged.back();
+            last.count = std::max(last.address + last.count, unit.address + unit.count) - last.address;
+        } else {
+            merged.push_back(unit);
+        }
+    }
+
+    // Greedy left to right: extending each request as far as possible minimises the request count
+    size_t i = 0;
+    while (i < merged.size()) {
+        const uint32_t request_start = merged[i].address;
+
+        // Oversized atomic units cannot be honoured, read them in chunks and plan the remainder normally
+        if (merged[i].count > max_count) {
+            plan.requests.push_back({static_cast<uint16_t>(request_start), static_cast<uint16_t>(max_count)});
+            merged[i].address += max_count;
+            merged[i].count -= max_count;
+            continue;
+        }
+
+        uint32_t end = request_start + merged[i].count;
+        size_t j = i + 1;
+        while (j < merged.size()) {
+            const auto& next = merged[j];
+            if (next.address - end > options.max_gap) {
+                break;
+            }
+            if (options.skip_unmapped && !range_readable(end, next.address)) {
+                break;
+            }
+            if (next.address + next.count - request_start > max_count) {
+                break;
+            }
+            end = next.address + next.count;
+            ++j;
+        }
+
+        plan.requests.push_back({static_cast<uint16_t>(request_start), static_cast<uint16_t>(end - request_start)});
+        i = j;
+    }
+
+    return plan;
+}
+
+} // namespace
+
+// ============================================================================
+// Read Planning
+// ============================================================================
+
+size_t ReadPlan::register_count() const {
+    size_t total = 0;
+    for (const auto& request : requests) {
+        total += request.count;
+    }
+    return total;
+}
+
+bool is_readable_register(uint16_t address) {
+    return readable_addresses().test(address);
+}
+
+ReadPlan plan_reads(std::span<const ReadRequest> ranges, const ReadPlanOptions& options) {
+    // Plain ranges are divisible, so they are planned register by register
+    std::vector<Unit> units;
+    for (const auto& range : ranges) {
+        for (uint32_t offset = 0; offset < range.count && range.address + offset < 0x10000; ++offset) {
+            units.push_back({range.address + offset, 1});
+        }
+    }
+    return plan_units(std::move(units), options);
+}
+
+ReadPlan plan_reads(std::span<const uint16_t> addresses, const ReadPlanOptions& options) {
+    std::vector<Unit> units;
+    units.reserve(addresses.size());
+    for (uint16_t address : addresses) {
+        units.push_back({address, 1});
+    }
+    return plan_units(std::move(units), options);
+}
+
+ReadPlan plan_reads(std::span<const RegisterInfo> registers, const ReadPlanOptions& options) {
+    std::vector<Unit> units;
+    units.reserve(registers.size());
+    for (const auto& reg : registers) {
+        const uint32_t count = std::max<uint32_t>(reg.num_registers, 1);
+        units.push_back({reg.address, std::min<uint32_t>(count, 0x10000 - reg.address)});
+    }
+    return plan_units(std::move(units), options);
+}
+
+const ReadPlan& status_snapshot_read_plan() {
+    static const ReadPlan plan = [] {
+        // 0x600A-0x600F is unmapped, so the block is planned as two ranges
+        const ReadRequest ranges[] = {
+            {0x6000, 0x600A - 0x6000},
+            {0x6010, 0x60D0 - 0x6010},
+        };
+        return plan_reads(std::span<const ReadRequest>(ranges));
+    }();
+    return plan;
+}
+
+// ============================================================================
+// Register Values
+// ============================================================================
+
+void RegisterValues::assign(uint16_t address, std::span<const uint16_t> values) {
+    for (size_t i = 0; i < values.size() && address + i < 0x10000; ++i) {
+        const auto addr = static_cast<uint16_t>(address + i);
+        // Fast path: blocks are usually assigned in ascending address order
+        if (addresses_.empty() || addr > addresses_.back()) {
+            addresses_.push_back(addr);
+            values_.push_back(values[i]);
+            continue;
+        }
+        auto it = std::ranges::lower_bound(addresses_, addr);
+        const auto pos = it - addresses_.begin();
+        if (it != addresses_.end() && *it == addr) {
+            values_[pos] = values[i];
+        } else {
+            addresses_.insert(it, addr);
+            values_.insert(values_.begin() + pos, values[i]);
+        }
+    }
+}
+
+bool RegisterValues::contains(uint16_t address, uint16_t count) const {
+    return !get(address, count).empty();
+}
+
+std::optional<uint16_t> RegisterValues::get(uint16_t address) const {
+    auto it = std::ranges::lower_bound(addresses_, address);
+    if (it == addresses_.end() || *it != address) {
+        return std::nullopt;
+    }
+    return values_[it - addresses_.begin()];
+}
+
+std::span<const uint16_t> RegisterValues::get(uint16_t address, uint16_t count) const {
+    if (count == 0) {
+        return {};
+    }
+    auto it = std::ranges::lower_bound(addresses_, address);
+    const size_t pos = it - addresses_.begin();
+    // Addresses are unique and sorted: the range is complete iff the last one lines up
+    if (it == addresses_.end() || *it != address || pos + count > addresses_.size() ||
+        addresses_[pos + count - 1] != static_cast<uint32_t>(address) + count - 1) {
+        return {};
+    }
+    return std::span<const uint16_t>(values_).subspan(pos, count);
+}
+
+void RegisterValues::clear() {
+    addresses_.clear();
+    values_.clear();
+}
+
+std::optional<RegisterValue> decode_register(const RegisterInfo& info, const RegisterValues& values) {
+    const uint16_t count = std::max<uint16_t>(info.num_registers, 1);
+    auto words = values.get(info.address, count);
+    if (words.empty()) {
+        return std::nullopt;
+    }
+
+    // MODBUS uses big endian: words[0] is the high word
+    const uint32_t dword = count >= 2 ? (static_cast<uint32_t>(words[0]) << 16) | words[1] : words[0];
+    switch (info.type) {
+        case RegisterType::UINT16: return RegisterValue{words[0]};
+        case RegisterType::INT16: return RegisterValue{static_cast<int16_t>(words[0])};
+        case RegisterType::UINT32: return RegisterValue{dword};
+        case RegisterType::INT32: return RegisterValue{static_cast<int32_t>(dword)};
+        case RegisterType::FLOAT: return RegisterValue{std::bit_cast<float>(dword)};
+        case RegisterType::STRING32: return RegisterValue{decode_string(words)};
+    }
+    return std::nullopt;
+}
+
+// ============================================================================
+// Planned Reads
+// ============================================================================
+
+std::optional<RegisterValues> execute_read_plan(libmodbus_cpp::ModbusConnection& conn, const ReadPlan& plan) {
+    RegisterValues values;
+    std::array<uint16_t, max_read_registers> buffer{};
+    for (const auto& request : plan.requests) {
+        auto block = std::span(buffer).first(request.count);
+        if (!read_registers(conn, request.address, block)) {
+            return std::nullopt;
+        }
+        values.assign(request.address, block);
+    }
+    return values;
+}
+
+RegisterValues execute_read_plan(libmodbus_cpp::ModbusConnection& conn, const ReadPlan& plan, Deadline deadline, std::stop_token stop) {
+    RegisterValues values;
+    std::array<uint16_t, max_read_registers> buffer{};
+    for (const auto& request : plan.requests) {
+        if (budget_exhausted(deadline, stop)) {
+            break;
+        }
+        auto block = std::span(buffer).first(request.count);
+        if (!read_registers(conn, request.address, block)) {
+            break;
+        }
+        values.assign(request.address, block);
+    }
+    return values;
+}
+
+std::optional<RegisterValues> read_planned(libmodbus_cpp::ModbusConnection& conn, std::span<const uint16_t> addresses, const ReadPlanOptions& options) {
+    return execute_read_plan(conn, plan_reads(addresses, options));
+}
+
+std::optional<std::map<uint16_t, RegisterValue>> read_planned(libmodbus_cpp::ModbusConnection& conn, std::span<const RegisterInfo> registers, const ReadPlanOptions& options) {
+    auto values = execute_read_plan(conn, plan_reads(registers, options));
+    if (!values) {
+        return std::nullopt;
+    }
+
+    std::map<uint16_t, RegisterValue> result;
+    for (const auto& reg : registers) {
+        if (auto value = decode_register(reg, *values)) {
+            result.emplace(reg.address, std::move(*value));
+        }
+    }
+    return result;
+}
+
+// ============================================================================
+// Register Families
+// ============================================================================
+
+std::optional<RegisterValues> read_family(libmodbus_cpp::ModbusConnection& conn, const RegisterFamily& family, const ReadPlanOptions& options) {
+    if (family.access == RegisterAccess::WRITE_ONLY) {
+        throw std::invalid_argument(std::format("Register family {} is write-only", family.name));
+    }
+    // Planned member by member, so a STRING32 or UINT32 is never split across requests
+    return execute_read_plan(conn, plan_units(family_units(family, 1, family.modules), options));
+}
+
+std::optional<RegisterValues> read_family_module(libmodbus_cpp::ModbusConnection& conn, const RegisterFamily& family, uint8_t module_number, const ReadPlanOptions& options) {
+    if (family.access == RegisterAccess::WRITE_ONLY) {
+        throw std::invalid_argument(std::format("Register family {} is write-only", family.name));
+    }
+    if (module_number < 1 || module_number > family.modules) {
+        throw std::invalid_argument(std::format("Module number must be between 1 and {}", family.modules));
+    }
+    return execute_read_plan(conn, plan_units(family_units(family, module_number, module_number), options));
+}
+
+} // namespace v1
+} // namespace caparoc
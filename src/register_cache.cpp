@@ -0,0 +1,220 @@
+#include "caparoc/register_cache.hpp"
+#include "caparoc/read_planner.hpp"
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Register Value Cache
+// ============================================================================
+
+RegisterCache::RegisterCache() {
+    using namespace std::chrono_literals;
+    ttl_.fill(clock::duration::zero());
+    ttl_[static_cast<size_t>(RegisterClass::identification)] = 1h;
+    ttl_[static_cast<size_t>(RegisterClass::topology)] = 10s;
+    ttl_[static_cast<size_t>(RegisterClass::status)] = 100ms;
+    ttl_[static_cast<size_t>(RegisterClass::quint)] = 1s;
+    ttl_[static_cast<size_t>(RegisterClass::configuration)] = 1s;
+}
+
+void RegisterCache::set_ttl(RegisterClass register_class, clock::duration ttl) {
+    std::lock_guard lock(mutex_);
+    ttl_[static_cast<size_t>(register_class)] = ttl;
+}
+
+RegisterCache::clock::duration RegisterCache::ttl(RegisterClass register_class) const {
+    std::lock_guard lock(mutex_);
+    return ttl_[static_cast<size_t>(register_class)];
+}
+
+bool RegisterCache::lookup(uint16_t address, std::span<uint16_t> values, clock::time_point now) {
+    {
+        std::lock_guard lock(mutex_);
+        bool fresh = !values.empty();
+        for (size_t i = 0; i < values.size() && fresh; ++i) {
+            const auto addr = static_cast<uint16_t>(address + i);
+            const auto ttl = ttl_[static_cast<size_t>(classify_register(addr))];
+            auto it = entries_.find(addr);
+            fresh = it != entries_.end() && now - it->second.acquired < ttl;
+            if (fresh) {
+                values[i] = it->second.value;
+            }
+        }
+        if (fresh) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void RegisterCache::store(uint16_t address, std::span<const uint16_t> values, clock::time_point acquired) {
+    std::lock_guard lock(mutex_);
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto addr = static_cast<uint16_t>(address + i);
+        if (ttl_[static_cast<size_t>(classify_register(addr))] > clock::duration::zero()) {
+            entries_[addr] = Entry{values[i], acquired};
+        }
+    }
+}
+
+void RegisterCache::invalidate(uint16_t address, uint16_t count) {
+    std::lock_guard lock(mutex_);
+    for (uint32_t i = 0; i < count; ++i) {
+        entries_.erase(static_cast<uint16_t>(address + i));
+    }
+}
+
+void RegisterCache::invalidate(RegisterClass register_class) {
+    std::lock_guard lock(mutex_);
+    std::erase_if(entries_, [register_class](const auto& entry) {
+        return classify_register(entry.first) == register_class;
+    });
+}
+
+void RegisterCache::clear() {
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+// ============================================================================
+// Cached Accessors
+// ============================================================================
+
+bool read_registers(CachedConnection& conn, uint16_t address, std::span<uint16_t> values) {
+    if (conn.cache().lookup(address, values)) {
+        return true;
+    }
+    const auto acquired = RegisterCache::clock::now();
+    if (!read_registers(conn.connection(), address, values)) {
+        return false;
+    }
+    conn.cache().store(address, values, acquired);
+    return true;
+}
+
+bool write_registers(CachedConnection& conn, uint16_t address, std::span<const uint16_t> values) {
+    // Invalidate even on failure, the device may have applied part of the write
+    conn.cache().invalidate(address, static_cast<uint16_t>(values.size()));
+    if (classify_register(address) == RegisterClass::control) {
+        conn.cache().invalidate(RegisterClass::status);
+    }
+    return write_registers(conn.connection(), address, values);
+}
+
+std::optional<uint16_t> read_uint16(CachedConnection& conn, uint16_t address) {
+    uint16_t value;
+    if (!read_registers(conn, address, std::span(&value, 1))) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::optional<uint32_t> read_uint32(CachedConnection& conn, uint16_t address) {
+    uint16_t values[2];
+    if (!read_registers(conn, address, values)) {
+        return std::nullopt;
+    }
+    return (static_cast<uint32_t>(values[0]) << 16) | values[1];
+}
+
+std::optional<std::string> read_string32(CachedConnection& conn, uint16_t address) {
+    uint16_t values[16];
+    if (!read_registers(conn, address, values)) {
+        return std::nullopt;
+    }
+    return decode_string(values);
+}
+
+bool write_uint16(CachedConnection& conn, uint16_t address, uint16_t value) {
+    return write_registers(conn, address, std::span(&value, 1));
+}
+
+std::optional<std::string> get_product_name_power_module(CachedConnection& conn) {
+    return read_string32(conn, 0x1000);
+}
+
+std::optional<std::string> get_product_name_quint(CachedConnection& conn) {
+    return read_string32(conn, 0x1110);
+}
+
+std::optional<GlobalStatus> get_global_status(CachedConnection& conn) {
+    auto val = read_uint16(conn, 0x6000);
+    if (!val) {
+        return std::nullopt;
+    }
+    return decode_global_status(*val);
+}
+
+std::optional<uint16_t> get_total_system_current(CachedConnection& conn) {
+    return read<regs::TOTAL_SYSTEM_CURRENT>(conn);
+}
+
+std::optional<uint16_t> get_input_voltage(CachedConnection& conn) {
+    return read<regs::INPUT_VOLTAGE>(conn);
+}
+
+std::optional<uint16_t> get_sum_of_nominal_currents(CachedConnection& conn) {
+    return read<regs::SUM_OF_NOMINAL_CURRENTS>(conn);
+}
+
+std::optional<int16_t> get_internal_temperature(CachedConnection& conn) {
+    return read<regs::INTERNAL_TEMPERATURE>(conn);
+}
+
+std::optional<std::string> get_product_name_module(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number) {
+    topology.ensure_valid(conn.connection());
+    topology.validate_module_number(module_number);
+    auto name = read_string32(conn, families::PRODUCT_NAME.address(module_number));
+    if (!name) {
+        topology.invalidate();
+    }
+    return name;
+}
+
+std::optional<uint16_t> get_nominal_current(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    topology.ensure_valid(conn.connection());
+    topology.validate_channel_number(module_number, channel_number);
+    auto value = read_uint16(conn, families::NOMINAL_CURRENT.address(module_number, channel_number));
+    if (!value) {
+        topology.invalidate();
+    }
+    return value;
+}
+
+std::optional<ChannelStatus> get_channel_status(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    topology.ensure_valid(conn.connection());
+    topology.validate_channel_number(module_number, channel_number);
+    auto val = read_uint16(conn, families::STATUS.address(module_number, channel_number));
+    if (!val) {
+        topology.invalidate();
+        return std::nullopt;
+    }
+    return decode_channel_status(*val);
+}
+
+std::optional<uint16_t> get_load_current(CachedConnection& conn, DeviceTopology& topology, uint8_t module_number, uint8_t channel_number) {
+    topology.ensure_valid(conn.connection());
+    topology.validate_channel_number(module_number, channel_number);
+    auto value = read_uint16(conn, families::LOAD_CURRENT.address(module_number, channel_number));
+    if (!value) {
+        topology.invalidate();
+    }
+    return value;
+}
+
+std::optional<StatusSnapshot> read_status_snapshot(CachedConnection& conn) {
+    std::array<uint16_t, status_block_size> block{};
+    for (const auto& request : status_snapshot_read_plan().requests) {
+        auto values = std::span(block).subspan(request.address - status_block_address, request.count);
+        if (!read_registers(conn, request.address, values)) {
+            return std::nullopt;
+        }
+    }
+    return decode_status_snapshot(block);
+}
+
+} // namespace v1
+} // namespace caparoc
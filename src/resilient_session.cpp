@@ -0,0 +1,134 @@
+#include "caparoc/resilient_session.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Resilient Session
+// ============================================================================
+
+std::optional<BootIdentity> read_boot_identity(libmodbus_cpp::ModbusConnection& conn) {
+    constexpr uint16_t base = 0x6003;
+    std::array<uint16_t, 0x6009 - base> values{};
+    if (!read_registers(conn, base, values)) {
+        return std::nullopt;
+    }
+    return BootIdentity{
+        .connected_modules = values[0x6003 - base],
+        .connected_modules_at_boot = values[0x6004 - base],
+        .hours_since_last_boot = values[0x6008 - base],
+    };
+}
+
+ResilientSession::ResilientSession(ConnectionFactory factory, ResilientSessionOptions options)
+    : factory_(std::move(factory))
+    , options_(options)
+    , random_(std::random_device{}()) {
+}
+
+bool ResilientSession::ensure_connected(clock::time_point now) {
+    if (conn_) {
+        return true;
+    }
+    if (now < next_attempt_) {
+        return false;
+    }
+    return connect(now);
+}
+
+void ResilientSession::disconnect(clock::time_point now) {
+    conn_.reset();
+    consecutive_failures_ = 0;
+    schedule_retry(now);
+}
+
+bool ResilientSession::connect(clock::time_point now) {
+    conn_ = factory_();
+    if (!conn_) {
+        schedule_retry(now);
+        return false;
+    }
+
+    auto result = revalidate(now);
+    if (result && *result == Revalidation::unchanged && !topology_.valid() && !topology_.refresh(*conn_)) {
+        result.reset();
+    }
+    if (!result || (*result != Revalidation::unchanged && !reload())) {
+        conn_.reset();
+        schedule_retry(now);
+        return false;
+    }
+
+    attempts_ = 0;
+    consecutive_failures_ = 0;
+    ++connects_;
+    if (on_revalidation_) {
+        on_revalidation_(*result);
+    }
+    return true;
+}
+
+std::optional<Revalidation> ResilientSession::revalidate(clock::time_point now) {
+    auto identity = read_boot_identity(*conn_);
+    if (!identity) {
+        return std::nullopt;
+    }
+
+    Revalidation result = Revalidation::unchanged;
+    if (!identity_ || !inventory_) {
+        result = Revalidation::initial;
+    } else {
+        // Both readings are truncated to full hours, so the counter may be one ahead of the elapsed time
+        const auto elapsed = std::chrono::duration_cast<std::chrono::hours>(now - identity_time_).count();
+        const int64_t expected = identity_->hours_since_last_boot + elapsed;
+        const int64_t hours = identity->hours_since_last_boot;
+        if (hours < expected || hours > expected + 1 ||
+            identity->connected_modules_at_boot != identity_->connected_modules_at_boot) {
+            result = Revalidation::rebooted;
+        } else if (identity->connected_modules != identity_->connected_modules) {
+            result = Revalidation::topology_changed;
+        }
+    }
+
+    identity_ = identity;
+    identity_time_ = now;
+    return result;
+}
+
+bool ResilientSession::reload() {
+    // A failed reload leaves no inventory, so the next connect reloads again
+    inventory_.reset();
+    topology_.invalidate();
+    if (!topology_.refresh(*conn_)) {
+        return false;
+    }
+    ++inventory_reads_;
+    inventory_ = read_inventory(*conn_, topology_);
+    return inventory_.has_value();
+}
+
+void ResilientSession::schedule_retry(clock::time_point now) {
+    using milliseconds = std::chrono::duration<double, std::milli>;
+    const double growth = std::pow(std::max(options_.backoff_multiplier, 1.0), attempts_);
+    const double wait = std::min(options_.initial_backoff.count() * growth, static_cast<double>(options_.max_backoff.count()));
+    ++attempts_;
+
+    // Randomise the upper part of the wait so that many clients spread out
+    std::uniform_real_distribution<double> spread(1.0 - std::clamp(options_.jitter, 0.0, 1.0), 1.0);
+    next_attempt_ = now + std::chrono::duration_cast<clock::duration>(milliseconds(wait * spread(random_)));
+}
+
+void ResilientSession::record_result(bool ok) {
+    if (ok) {
+        consecutive_failures_ = 0;
+        return;
+    }
+    if (++consecutive_failures_ >= std::max(options_.failures_before_reconnect, 1u)) {
+        disconnect();
+    }
+}
+
+} // namespace v1
+} // namespace caparoc
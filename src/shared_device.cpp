@@ -0,0 +1,233 @@
+#include "caparoc/shared_device.hpp"
+#include "caparoc/read_planner.hpp"
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Shared Device Access
+// ============================================================================
+
+SharedDevice::SharedDevice(std::unique_ptr<libmodbus_cpp::ModbusConnection> conn)
+    : conn_(std::move(conn)) {
+    if (!conn_) {
+        throw std::invalid_argument("SharedDevice requires a connection");
+    }
+    worker_ = std::thread([this] { run(); });
+}
+
+SharedDevice::~SharedDevice() {
+    stopping_.store(true, std::memory_order_release);
+    signal_.fetch_add(1, std::memory_order_release);
+    signal_.notify_one();
+    worker_.join();
+}
+
+std::future<std::optional<std::vector<uint16_t>>> SharedDevice::read_registers(uint16_t address, uint16_t count, Priority priority) {
+    std::promise<std::optional<std::vector<uint16_t>>> promise;
+    auto future = promise.get_future();
+    if (count == 0 || address + count > 0x10000) {
+        promise.set_value(std::nullopt);
+        return future;
+    }
+    submit_read(address, count, priority, [promise = std::move(promise)](std::optional<std::span<const uint16_t>> values) mutable {
+        if (values) {
+            promise.set_value(std::vector<uint16_t>(values->begin(), values->end()));
+        } else {
+            promise.set_value(std::nullopt);
+        }
+    });
+    return future;
+}
+
+std::future<std::optional<uint16_t>> SharedDevice::read_uint16(uint16_t address, Priority priority) {
+    std::promise<std::optional<uint16_t>> promise;
+    auto future = promise.get_future();
+    submit_read(address, 1, priority, [promise = std::move(promise)](std::optional<std::span<const uint16_t>> values) mutable {
+        promise.set_value(values ? std::optional<uint16_t>((*values)[0]) : std::nullopt);
+    });
+    return future;
+}
+
+std::future<bool> SharedDevice::write_uint16(uint16_t address, uint16_t value, Priority priority) {
+    return execute([address, value](libmodbus_cpp::ModbusConnection& conn) {
+        return caparoc::write_uint16(conn, address, value);
+    }, priority);
+}
+
+std::future<bool> SharedDevice::write_registers(uint16_t address, std::vector<uint16_t> values, Priority priority) {
+    return execute([address, values = std::move(values)](libmodbus_cpp::ModbusConnection& conn) {
+        return caparoc::write_registers(conn, address, values);
+    }, priority);
+}
+
+std::future<bool> SharedDevice::control_channel(uint8_t module_number, uint8_t channel_number, bool on, Priority priority) {
+    return execute([this, module_number, channel_number, on](libmodbus_cpp::ModbusConnection& conn) {
+        return caparoc::control_channel(conn, topology_, module_number, channel_number, on);
+    }, priority);
+}
+
+std::future<std::optional<StatusSnapshot>> SharedDevice::read_status_snapshot(Priority priority) {
+    // One read command per request of the plan, so control commands can go in between.
+    // Completions run on the worker thread, one at a time.
+    struct Snapshot {
+        std::promise<std::optional<StatusSnapshot>> promise;
+        std::array<uint16_t, status_block_size> block{};
+        size_t remaining = 0;
+        bool failed = false;
+    };
+    const auto& requests = status_snapshot_read_plan().requests;
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->remaining = requests.size();
+    auto future = snapshot->promise.get_future();
+    for (const auto& request : requests) {
+        submit_read(request.address, request.count, priority, [snapshot, request](std::optional<std::span<const uint16_t>> values) {
+            if (values) {
+                std::ranges::copy(*values, snapshot->block.begin() + (request.address - status_block_address));
+            } else {
+                snapshot->failed = true;
+            }
+            if (--snapshot->remaining == 0) {
+                snapshot->promise.set_value(snapshot->failed ? std::nullopt : std::optional(decode_status_snapshot(snapshot->block)));
+            }
+        });
+    }
+    return future;
+}
+
+QueueStatistics SharedDevice::statistics(Priority priority) const {
+    const auto& lane = statistics_[static_cast<size_t>(priority)];
+    QueueStatistics result;
+    result.commands = lane.commands.load(std::memory_order_relaxed);
+    result.total_wait = clock::duration(lane.total_wait.load(std::memory_order_relaxed));
+    result.max_wait = clock::duration(lane.max_wait.load(std::memory_order_relaxed));
+    return result;
+}
+
+void SharedDevice::submit_read(uint16_t address, uint16_t count, Priority priority, ReadCompletion complete) {
+    Command command{};
+    command.priority = priority;
+    command.address = address;
+    command.count = count;
+    command.complete = std::move(complete);
+    submit(std::move(command));
+}
+
+void SharedDevice::submit_action(Action action, Priority priority) {
+    Command command{};
+    command.priority = priority;
+    command.action = std::move(action);
+    submit(std::move(command));
+}
+
+void SharedDevice::submit(Command command) {
+    command.submitted = clock::now();
+    command.sequence = sequence_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    queue_.push(std::move(command));
+    signal_.fetch_add(1, std::memory_order_release);
+    signal_.notify_one();
+}
+
+void SharedDevice::record_wait(const Command& command) {
+    auto& lane = statistics_[static_cast<size_t>(command.priority)];
+    const int64_t wait = (clock::now() - command.submitted).count();
+    lane.commands.fetch_add(1, std::memory_order_relaxed);
+    lane.total_wait.fetch_add(wait, std::memory_order_relaxed);
+    int64_t max = lane.max_wait.load(std::memory_order_relaxed);
+    while (wait > max && !lane.max_wait.compare_exchange_weak(max, wait, std::memory_order_relaxed)) {
+    }
+}
+
+void SharedDevice::run() {
+    std::array<std::deque<Command>, priority_count> lanes;
+    auto drain = [this, &lanes] {
+        while (auto command = queue_.pop()) {
+            lanes[static_cast<size_t>(command->priority)].push_back(std::move(*command));
+        }
+    };
+    
+    while (true) {
+        const uint32_t signal = signal_.load(std::memory_order_acquire);
+        drain();
+        auto lane = std::ranges::find_if(lanes, [](const auto& commands) { return !commands.empty(); });
+        if (lane == lanes.end()) {
+            if (stopping_.load(std::memory_order_acquire)) {
+                return;
+            }
+            signal_.wait(signal, std::memory_order_acquire);
+            continue;
+        }
+        
+        if (!lane->front().is_read()) {
+            Command command = std::move(lane->front());
+            lane->pop_front();
+            record_wait(command);
+            // Split reads in progress now mix values from before and after this action
+            for (auto& commands : lanes) {
+                if (!commands.empty() && commands.front().is_read() && commands.front().done > 0) {
+                    commands.front().interleaved = std::min(commands.front().interleaved, command.sequence);
+                }
+            }
+            command.action(*conn_);
+            continue;
+        }
+        
+        // One PDU per iteration, so higher priority commands can go between the chunks
+        Command& read = lane->front();
+        if (read.done == 0) {
+            record_wait(read);
+            read.values.resize(read.count);
+        }
+        const auto chunk = std::min<uint16_t>(read.count - read.done, max_read_registers);
+        if (caparoc::read_registers(*conn_, static_cast<uint16_t>(read.address + read.done), std::span(read.values).subspan(read.done, chunk))) {
+            read.done += chunk;
+        } else {
+            read.failed = true;
+        }
+        if (!read.failed && read.done < read.count) {
+            continue;
+        }
+        
+        Command command = std::move(read);
+        lane->pop_front();
+        
+        // Everything submitted up to now was waiting during the transaction
+        const uint64_t completed = sequence_.load(std::memory_order_acquire);
+        drain();
+        std::optional<std::span<const uint16_t>> result;
+        if (!command.failed) {
+            result = std::span<const uint16_t>(command.values);
+        }
+        command.complete(result);
+        
+        // Join identical reads, but not those submitted after a write or execute() that is still
+        // pending or that ran between the chunks of this read
+        uint64_t barrier = command.interleaved;
+        for (const auto& commands : lanes) {
+            for (const auto& pending : commands) {
+                if (!pending.is_read()) {
+                    barrier = std::min(barrier, pending.sequence);
+                }
+            }
+        }
+        for (auto& commands : lanes) {
+            std::erase_if(commands, [&](Command& pending) {
+                const bool join = pending.is_read() && pending.done == 0 && pending.sequence <= completed &&
+                    pending.sequence < barrier && pending.address == command.address && pending.count == command.count;
+                if (join) {
+                    record_wait(pending);
+                    pending.complete(result);
+                    coalesced_reads_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return join;
+            });
+        }
+    }
+}
+
+} // namespace v1
+} // namespace caparoc
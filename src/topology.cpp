@@ -0,0 +1,108 @@
+#include "caparoc/caparoc.hpp"
+#include <format>
+#include <algorithm>
+#include <stdexcept>
+
+namespace caparoc {
+inline namespace v1 {
+
+// ============================================================================
+// Device Topology
+// ============================================================================
+
+bool DeviceTopology::refresh(libmodbus_cpp::ModbusConnection& conn) {
+    // 0x2000: number of connected modules, 0x2001-0x2010: channels per module
+    std::array<uint16_t, 1 + max_modules> values{};
+    if (!read_registers(conn, 0x2000, values)) {
+        invalidate();
+        return false;
+    }
+    
+    module_count_ = std::min<uint16_t>(values[0], max_modules);
+    for (size_t i = 0; i < max_modules; ++i) {
+        channel_counts_[i] = i < module_count_ ? std::min<uint16_t>(values[i + 1], channels_per_module) : 0;
+    }
+    valid_ = true;
+    return true;
+}
+
+void DeviceTopology::ensure_valid(libmodbus_cpp::ModbusConnection& conn) {
+    if (!valid_ && !refresh(conn)) {
+        throw std::invalid_argument("Failed to read number of connected modules from device");
+    }
+}
+
+void DeviceTopology::invalidate() {
+    const bool was_valid = valid_;
+    valid_ = false;
+    module_count_ = 0;
+    channel_counts_.fill(0);
+    
+    if (was_valid) {
+        handlers_.notify();
+    }
+}
+
+bool DeviceTopology::invalidate_if_changed(const StatusSnapshot& snapshot) {
+    if (valid_ && snapshot.measurements.connected_modules != module_count_) {
+        invalidate();
+        return true;
+    }
+    return false;
+}
+
+uint16_t DeviceTopology::channel_count(uint8_t module_number) const {
+    if (module_number < 1 || module_number > module_count_) {
+        return 0;
+    }
+    return channel_counts_[module_number - 1];
+}
+
+bool DeviceTopology::contains(uint8_t module_number, uint8_t channel_number) const {
+    return channel_number >= 1 && channel_number <= channel_count(module_number);
+}
+
+std::bitset<max_channels> DeviceTopology::channel_mask() const {
+    std::bitset<max_channels> mask;
+    for (uint8_t module = 1; module <= module_count_; ++module) {
+        for (uint8_t channel = 1; channel <= channel_count(module); ++channel) {
+            mask.set(channel_index(module, channel));
+        }
+    }
+    return mask;
+}
+
+void DeviceTopology::validate_module_number(uint8_t module_number) const {
+    if (!valid_) {
+        throw std::invalid_argument("Device topology has not been read from device");
+    }
+    if (module_number < 1 || module_number > module_count_) {
+        throw std::invalid_argument(std::format(
+            "Invalid module number: {}. Expected value between 1 and {} (number of connected modules)",
+            module_number, module_count_
+        ));
+    }
+}
+
+void DeviceTopology::validate_channel_number(uint8_t module_number, uint8_t channel_number) const {
+    validate_module_number(module_number);
+    
+    uint16_t num_channels = channel_count(module_number);
+    if (channel_number < 1 || channel_number > num_channels) {
+        throw std::invalid_argument(std::format(
+            "Invalid channel number: {} for module {}. Expected value between 1 and {} (number of channels for this module)",
+            channel_number, module_number, num_channels
+        ));
+    }
+}
+
+size_t DeviceTopology::add_invalidation_handler(InvalidationHandler handler) {
+    return handlers_.add(std::move(handler));
+}
+
+void DeviceTopology::remove_invalidation_handler(size_t handle) {
+    handlers_.remove(handle);
+}
+
+} // namespace v1
+} // namespace caparoc
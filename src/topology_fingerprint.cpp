@@ -0,0 +1,162 @@
+#include "caparoc/topology_fingerprint.hpp"
+#include "caparoc/read_planner.hpp"
+#include <algorithm>
+
+namespace caparoc {
+inline namespace v1 {
+
+namespace {
+
+// Slots with a device behind them: power module, connected modules and QUINT
+std::vector<size_t> present_slots(const TopologyFingerprint& fingerprint) {
+    std::vector<size_t> slots;
+    for (size_t slot = 0; slot <= fingerprint.module_count; ++slot) {
+        slots.push_back(slot);
+    }
+    slots.push_back(quint_serial_slot);
+    return slots;
+}
+
+} // namespace
+
+// ============================================================================
+// Topology Fingerprint
+// ============================================================================
+
+uint64_t TopologyFingerprint::value() const {
+    uint64_t hash = fnv1a(std::span(&module_count, 1));
+    hash = fnv1a(channel_counts, hash);
+    for (uint64_t serial : serial_hashes) {
+        const uint16_t words[] = {
+            static_cast<uint16_t>(serial >> 48), static_cast<uint16_t>(serial >> 32),
+            static_cast<uint16_t>(serial >> 16), static_cast<uint16_t>(serial),
+        };
+        hash = fnv1a(words, hash);
+    }
+    return hash;
+}
+
+// ============================================================================
+// Topology Tracker
+// ============================================================================
+
+TopologyTracker::TopologyTracker(TopologyTrackerOptions options)
+    : options_(options) {
+}
+
+std::optional<bool> TopologyTracker::refresh(libmodbus_cpp::ModbusConnection& conn) {
+    auto next = read_counts(conn);
+    if (!next || !read_serials(conn, present_slots(*next), *next)) {
+        return std::nullopt;
+    }
+    return commit(*next);
+}
+
+std::optional<bool> TopologyTracker::update(libmodbus_cpp::ModbusConnection& conn) {
+    if (!valid_) {
+        return refresh(conn);
+    }
+
+    auto counts = read_counts(conn);
+    if (!counts) {
+        return std::nullopt;
+    }
+    if (counts->module_count != fingerprint_.module_count || counts->channel_counts != fingerprint_.channel_counts) {
+        if (!read_serials(conn, present_slots(*counts), *counts)) {
+            return std::nullopt;
+        }
+        return commit(*counts);
+    }
+
+    // Same counts: verify the next batch of serial numbers
+    const auto slots = present_slots(fingerprint_);
+    const size_t batch_size = std::clamp<size_t>(options_.serial_slots_per_update, 1, slots.size());
+    std::vector<size_t> batch;
+    for (size_t i = 0; i < batch_size; ++i) {
+        batch.push_back(slots[(cursor_ + i) % slots.size()]);
+    }
+
+    TopologyFingerprint next = fingerprint_;
+    if (!read_serials(conn, batch, next)) {
+        return std::nullopt;
+    }
+    cursor_ = (cursor_ + batch_size) % slots.size();
+    return commit(next);
+}
+
+size_t TopologyTracker::add_change_handler(ChangeHandler handler) {
+    return handlers_.add(std::move(handler));
+}
+
+void TopologyTracker::remove_change_handler(size_t handle) {
+    handlers_.remove(handle);
+}
+
+void TopologyTracker::attach(DeviceTopology& topology) {
+    topologies_.push_back(&topology);
+}
+
+void TopologyTracker::detach(DeviceTopology& topology) {
+    std::erase(topologies_, &topology);
+}
+
+std::optional<TopologyFingerprint> TopologyTracker::read_counts(libmodbus_cpp::ModbusConnection& conn) const {
+    // 0x2000: number of connected modules, 0x2001-0x2010: channels per module
+    std::array<uint16_t, 1 + max_modules> values{};
+    if (!read_registers(conn, 0x2000, values)) {
+        return std::nullopt;
+    }
+
+    TopologyFingerprint fingerprint;
+    fingerprint.module_count = std::min<uint16_t>(values[0], max_modules);
+    for (size_t i = 0; i < fingerprint.module_count; ++i) {
+        fingerprint.channel_counts[i] = values[i + 1];
+    }
+    return fingerprint;
+}
+
+bool TopologyTracker::read_serials(libmodbus_cpp::ModbusConnection& conn, std::span<const size_t> slots, TopologyFingerprint& fingerprint) const {
+    std::vector<ReadRequest> ranges;
+    ranges.reserve(slots.size());
+    for (size_t slot : slots) {
+        ranges.push_back({serial_number_address(slot), 16});
+    }
+
+    const auto values = execute_read_plan(conn, plan_reads(std::span<const ReadRequest>(ranges)));
+    if (!values) {
+        return false;
+    }
+    for (size_t slot : slots) {
+        fingerprint.serial_hashes[slot] = fnv1a(values->get(serial_number_address(slot), 16));
+    }
+    return true;
+}
+
+bool TopologyTracker::commit(const TopologyFingerprint& fingerprint) {
+    const bool changed = valid_ && fingerprint != fingerprint_;
+    TopologyChange change{fingerprint_, fingerprint, false, {}};
+    fingerprint_ = fingerprint;
+    valid_ = true;
+    if (!changed) {
+        return false;
+    }
+
+    change.counts_changed = change.previous.module_count != change.current.module_count ||
+                            change.previous.channel_counts != change.current.channel_counts;
+    for (size_t slot = 0; slot < serial_slot_count; ++slot) {
+        change.serials_changed[slot] = change.previous.serial_hashes[slot] != change.current.serial_hashes[slot];
+    }
+
+    // Handlers may attach or detach, so invalidate from a copy and skip detached ones
+    const auto topologies = topologies_;
+    for (auto* topology : topologies) {
+        if (std::ranges::find(topologies_, topology) != topologies_.end()) {
+            topology->invalidate();
+        }
+    }
+    handlers_.notify(change);
+    return true;
+}
+
+} // namespace v1
+} // namespace caparoc